@@ -0,0 +1,267 @@
+#ifndef AISDI_LINEAR_BITVECTOR_H
+#define AISDI_LINEAR_BITVECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+	namespace detail {
+		inline std::size_t popcount64(std::uint64_t word) {
+#if defined(__GNUC__)
+			return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+			std::size_t count = 0;
+			for (; word != 0; word &= word - 1) count++;
+			return count;
+#endif
+		}
+
+		inline std::size_t countTrailingZeros64(std::uint64_t word) {
+#if defined(__GNUC__)
+			return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+			std::size_t count = 0;
+			for (; (word & 1) == 0; word >>= 1) count++;
+			return count;
+#endif
+		}
+	}
+
+	// One bit per flag, packed into 64-bit words. Bits past the last flag are
+	// always zero, so whole-word loops (popcount, and, or) need no masking and
+	// vectorize as plain array loops.
+	class BitVector {
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = bool;
+		using word_type = std::uint64_t;
+
+		class ConstIterator;
+
+		using iterator = ConstIterator;
+		using const_iterator = ConstIterator;
+
+		static constexpr size_type wordBits = 64;
+
+	private:
+		Vector<word_type> words;
+		size_type size;
+
+		static size_type wordsFor(size_type bits) {
+			return (bits + wordBits - 1) / wordBits;
+		}
+
+		void checkSameSize(const BitVector &other) const {
+			if (other.size != size) throw std::invalid_argument("BitVector size mismatch");
+		}
+
+	public:
+		BitVector() : size(0) {}
+
+		BitVector(size_type count, bool value) : size(count) {
+			words.ensureCapacity(wordsFor(count));
+			for (size_type i = 0; i < wordsFor(count); i++) words.append(value ? ~word_type(0) : 0);
+			if (value && count % wordBits != 0) {
+				words.data()[words.getSize() - 1] = (word_type(1) << (count % wordBits)) - 1;
+			}
+		}
+
+		BitVector(std::initializer_list<bool> l) : size(0) {
+			for (auto it = l.begin(); it != l.end(); ++it) append(*it);
+		}
+
+		bool isEmpty() const {
+			return size == 0;
+		}
+
+		size_type getSize() const {
+			return size;
+		}
+
+		size_type getWordCount() const {
+			return words.getSize();
+		}
+
+		const word_type *data() const {
+			return words.data();
+		}
+
+		bool operator[](size_type index) const {
+			if (index >= size) throw std::out_of_range("op[]");
+			return (words.data()[index / wordBits] >> (index % wordBits)) & 1;
+		}
+
+		void set(size_type index, bool value) {
+			if (index >= size) throw std::out_of_range("set");
+			word_type mask = word_type(1) << (index % wordBits);
+			word_type &word = words.data()[index / wordBits];
+			word = value ? (word | mask) : (word & ~mask);
+		}
+
+		void append(bool value) {
+			if (size % wordBits == 0) words.append(0);
+			size++;
+			set(size - 1, value);
+		}
+
+		bool popLast() {
+			if (size == 0) throw std::logic_error("popLast");
+			bool value = (*this)[size - 1];
+			set(size - 1, false);
+			size--;
+			if (size % wordBits == 0) words.popLast();
+			return value;
+		}
+
+		size_type popcount() const {
+			const word_type *word = words.data();
+			size_type count = 0;
+			for (size_type i = 0; i < words.getSize(); i++) count += detail::popcount64(word[i]);
+			return count;
+		}
+
+		// Index of the first set bit at or after `from`, or getSize() if none.
+		size_type findNext(size_type from) const {
+			if (from >= size) return size;
+			const word_type *word = words.data();
+			size_type index = from / wordBits;
+			word_type current = word[index] & (~word_type(0) << (from % wordBits));
+			while (current == 0) {
+				if (++index == words.getSize()) return size;
+				current = word[index];
+			}
+			return index * wordBits + detail::countTrailingZeros64(current);
+		}
+
+		BitVector &operator&=(const BitVector &other) {
+			checkSameSize(other);
+			word_type *word = words.data();
+			const word_type *otherWord = other.words.data();
+			for (size_type i = 0; i < words.getSize(); i++) word[i] &= otherWord[i];
+			return *this;
+		}
+
+		BitVector &operator|=(const BitVector &other) {
+			checkSameSize(other);
+			word_type *word = words.data();
+			const word_type *otherWord = other.words.data();
+			for (size_type i = 0; i < words.getSize(); i++) word[i] |= otherWord[i];
+			return *this;
+		}
+
+		BitVector &operator^=(const BitVector &other) {
+			checkSameSize(other);
+			word_type *word = words.data();
+			const word_type *otherWord = other.words.data();
+			for (size_type i = 0; i < words.getSize(); i++) word[i] ^= otherWord[i];
+			return *this;
+		}
+
+		const_iterator cbegin() const;
+
+		const_iterator cend() const;
+
+		const_iterator begin() const;
+
+		const_iterator end() const;
+	};
+
+	class BitVector::ConstIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = bool;
+		using difference_type = BitVector::difference_type;
+		using pointer = void;
+		using reference = bool;
+	private:
+		const BitVector *owner;
+		size_type index;
+	public:
+		explicit ConstIterator() : owner(nullptr), index(0) {}
+
+		ConstIterator(const BitVector *owner, size_type index) : owner(owner), index(index) {}
+
+		size_type getIndex() const {
+			return index;
+		}
+
+		reference operator*() const {
+			if (index == owner->size) throw std::out_of_range("op*");
+			return (*owner)[index];
+		}
+
+		ConstIterator &operator++() {
+			if (index == owner->size) throw std::out_of_range("++op");
+			index++;
+			return *this;
+		}
+
+		ConstIterator operator++(int) {
+			ConstIterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		ConstIterator &operator--() {
+			if (index == 0) throw std::out_of_range("--op");
+			index--;
+			return *this;
+		}
+
+		ConstIterator operator--(int) {
+			ConstIterator tmp = *this;
+			--(*this);
+			return tmp;
+		}
+
+		ConstIterator operator+(difference_type d) const {
+			ConstIterator tmp = *this;
+			if (static_cast<difference_type>(index) + d > static_cast<difference_type>(owner->size))
+				throw std::out_of_range("op+");
+			tmp.index += d;
+			return tmp;
+		}
+
+		ConstIterator operator-(difference_type d) const {
+			ConstIterator tmp = *this;
+			if (static_cast<difference_type>(index) - d < 0) throw std::out_of_range("op-");
+			tmp.index -= d;
+			return tmp;
+		}
+
+		bool operator==(const ConstIterator &other) const {
+			return owner == other.owner && index == other.index;
+		}
+
+		bool operator!=(const ConstIterator &other) const {
+			return !(*this == other);
+		}
+	};
+
+	inline BitVector::const_iterator BitVector::cbegin() const {
+		return const_iterator(this, 0);
+	}
+
+	inline BitVector::const_iterator BitVector::cend() const {
+		return const_iterator(this, size);
+	}
+
+	inline BitVector::const_iterator BitVector::begin() const {
+		return cbegin();
+	}
+
+	inline BitVector::const_iterator BitVector::end() const {
+		return cend();
+	}
+
+}
+
+#endif // AISDI_LINEAR_BITVECTOR_H
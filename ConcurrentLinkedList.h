@@ -0,0 +1,343 @@
+#ifndef AISDI_LINEAR_CONCURRENTLINKEDLIST_H
+#define AISDI_LINEAR_CONCURRENTLINKEDLIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+	// Linked list for read-mostly data shared between threads, in the style of
+	// RCU with quiescent-state-based reclamation (QSBR).
+	//
+	// Readers traverse without locks and without any atomic writes: an iterator
+	// only performs acquire loads of the next pointers. Writers are serialized
+	// by a mutex and publish every change with a single release store, so a
+	// reader sees either the old or the new list, never a half-linked node.
+	//
+	// An erased node is unlinked at once but freed only after a grace period:
+	// once every registered Reader has announced a quiescent state (a point
+	// where it holds no iterators into the list) after the unlink. Reader
+	// threads therefore construct a Reader, call quiescent() between
+	// traversals, and go offline() while idle so they do not hold up reclamation.
+	template<typename Type>
+	class ConcurrentLinkedList {
+	private:
+		class Node {
+		public:
+			const Type data;
+			std::atomic<Node *> next;
+			Node *prev; // only touched by the writer
+
+			Node(const Type &value) : data(value), next(nullptr), prev(nullptr) {}
+
+			Node(Type &&value) : data(std::move(value)), next(nullptr), prev(nullptr) {}
+		};
+
+		class Retired {
+		public:
+			Node *node;
+			std::uint64_t epoch;
+
+			Retired() : node(nullptr), epoch(0) {}
+
+			Retired(Node *node, std::uint64_t epoch) : node(node), epoch(epoch) {}
+		};
+
+		static constexpr std::uint64_t offlineEpoch = ~std::uint64_t(0);
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = Type;
+		using const_pointer = const Type *;
+		using const_reference = const Type &;
+
+		class ConstIterator;
+
+		class Reader;
+
+		using iterator = ConstIterator;
+		using const_iterator = ConstIterator;
+
+	private:
+		std::atomic<Node *> head;
+		std::atomic<size_type> size;
+		std::atomic<std::uint64_t> epoch;
+
+		std::mutex writerLock;
+		Node *tail;                // writer only
+		Vector<Retired> retired;   // writer only, ordered by epoch
+
+		std::mutex readersLock;
+		Vector<std::atomic<std::uint64_t> *> readers;
+
+		void linkBefore(Node *position, Node *newNode) {
+			Node *prev = position == nullptr ? tail : position->prev;
+			newNode->prev = prev;
+			newNode->next.store(position, std::memory_order_relaxed);
+			if (position == nullptr) tail = newNode;
+			else position->prev = newNode;
+			// publish: the node is fully built before it becomes reachable
+			if (prev == nullptr) head.store(newNode, std::memory_order_release);
+			else prev->next.store(newNode, std::memory_order_release);
+			size.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void unlink(Node *node) {
+			Node *next = node->next.load(std::memory_order_relaxed);
+			// node->next stays intact, so a reader standing on node can move on
+			if (node->prev == nullptr) head.store(next, std::memory_order_release);
+			else node->prev->next.store(next, std::memory_order_release);
+			if (next == nullptr) tail = node->prev;
+			else next->prev = node->prev;
+			size.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		void retire(Node *node) {
+			std::uint64_t retiredAt = epoch.fetch_add(1, std::memory_order_acq_rel) + 1;
+			retired.append(Retired(node, retiredAt));
+		}
+
+		// Oldest epoch some online reader may still be inside of.
+		std::uint64_t oldestReaderEpoch() {
+			// pairs with the fence in Reader::online(): either we see the reader
+			// online, or its traversal sees our unlink
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::lock_guard<std::mutex> guard(readersLock);
+			std::uint64_t oldest = offlineEpoch;
+			for (auto it = readers.begin(); it != readers.end(); ++it) {
+				std::uint64_t seen = (*it)->load(std::memory_order_acquire);
+				if (seen < oldest) oldest = seen;
+			}
+			return oldest;
+		}
+
+		void reclaimLocked() {
+			if (retired.isEmpty()) return;
+			std::uint64_t oldest = oldestReaderEpoch();
+			size_type freed = 0;
+			while (freed < retired.getSize() && retired.data()[freed].epoch <= oldest) {
+				delete (retired.data()[freed].node);
+				freed++;
+			}
+			if (freed > 0) retired.erase(retired.cbegin(), retired.cbegin() + freed);
+		}
+
+	public:
+		ConcurrentLinkedList() : head(nullptr), size(0), epoch(1), tail(nullptr) {}
+
+		ConcurrentLinkedList(std::initializer_list<Type> l) : ConcurrentLinkedList() {
+			for (auto it = l.begin(); it != l.end(); ++it) append(*it);
+		}
+
+		ConcurrentLinkedList(const ConcurrentLinkedList &) = delete;
+
+		ConcurrentLinkedList &operator=(const ConcurrentLinkedList &) = delete;
+
+		// Readers must be gone by now, so everything can be freed directly.
+		~ConcurrentLinkedList() {
+			Node *pos = head.load(std::memory_order_relaxed);
+			while (pos != nullptr) {
+				Node *next = pos->next.load(std::memory_order_relaxed);
+				delete (pos);
+				pos = next;
+			}
+			for (auto it = retired.begin(); it != retired.end(); ++it) delete ((*it).node);
+		}
+
+		bool isEmpty() const {
+			return getSize() == 0;
+		}
+
+		size_type getSize() const {
+			return size.load(std::memory_order_relaxed);
+		}
+
+		void append(const Type &item) {
+			append(Type(item));
+		}
+
+		void append(Type &&item) {
+			Node *newNode = new Node(std::move(item));
+			std::lock_guard<std::mutex> guard(writerLock);
+			linkBefore(nullptr, newNode);
+		}
+
+		void prepend(const Type &item) {
+			prepend(Type(item));
+		}
+
+		void prepend(Type &&item) {
+			Node *newNode = new Node(std::move(item));
+			std::lock_guard<std::mutex> guard(writerLock);
+			linkBefore(head.load(std::memory_order_relaxed), newNode);
+		}
+
+		// The position must not have been erased by another writer meanwhile;
+		// with a single writer thread that always holds.
+		void insert(const const_iterator &insertPosition, const Type &item) {
+			insert(insertPosition, Type(item));
+		}
+
+		void insert(const const_iterator &insertPosition, Type &&item) {
+			Node *newNode = new Node(std::move(item));
+			std::lock_guard<std::mutex> guard(writerLock);
+			linkBefore(insertPosition.getCurrent(), newNode);
+		}
+
+		void erase(const const_iterator &position) {
+			if (position.getCurrent() == nullptr) throw std::out_of_range("erase");
+			std::lock_guard<std::mutex> guard(writerLock);
+			unlink(position.getCurrent());
+			retire(position.getCurrent());
+			reclaimLocked();
+		}
+
+		template<typename Predicate>
+		size_type eraseIf(Predicate predicate) {
+			std::lock_guard<std::mutex> guard(writerLock);
+			size_type count = 0;
+			for (Node *pos = head.load(std::memory_order_relaxed); pos != nullptr;) {
+				Node *next = pos->next.load(std::memory_order_relaxed);
+				if (predicate(pos->data)) {
+					unlink(pos);
+					retire(pos);
+					count++;
+				}
+				pos = next;
+			}
+			reclaimLocked();
+			return count;
+		}
+
+		// Frees whatever retired nodes are already past their grace period.
+		void reclaim() {
+			std::lock_guard<std::mutex> guard(writerLock);
+			reclaimLocked();
+		}
+
+		// Blocks until every node erased so far has been freed. Must not be called
+		// by a thread that is itself an online reader.
+		void synchronize() {
+			std::unique_lock<std::mutex> guard(writerLock);
+			reclaimLocked();
+			while (!retired.isEmpty()) {
+				guard.unlock();
+				std::this_thread::yield();
+				guard.lock();
+				reclaimLocked();
+			}
+		}
+
+		const_iterator cbegin() const {
+			return const_iterator(head.load(std::memory_order_acquire));
+		}
+
+		const_iterator cend() const {
+			return const_iterator(nullptr);
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+	template<typename Type>
+	class ConcurrentLinkedList<Type>::ConstIterator {
+	private:
+		Node *current;
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = typename ConcurrentLinkedList::value_type;
+		using difference_type = typename ConcurrentLinkedList::difference_type;
+		using pointer = typename ConcurrentLinkedList::const_pointer;
+		using reference = typename ConcurrentLinkedList::const_reference;
+
+		explicit ConstIterator() : current(nullptr) {}
+
+		ConstIterator(Node *node) : current(node) {}
+
+		Node *getCurrent() const {
+			return current;
+		}
+
+		reference operator*() const {
+			if (current == nullptr) throw std::out_of_range("op*");
+			return current->data;
+		}
+
+		ConstIterator &operator++() {
+			if (current == nullptr) throw std::out_of_range("op++");
+			current = current->next.load(std::memory_order_acquire);
+			return *this;
+		}
+
+		ConstIterator operator++(int) {
+			ConstIterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		bool operator==(const ConstIterator &other) const {
+			return current == other.current;
+		}
+
+		bool operator!=(const ConstIterator &other) const {
+			return current != other.current;
+		}
+	};
+
+	// Registers the calling thread as a reader of one list for its lifetime.
+	template<typename Type>
+	class ConcurrentLinkedList<Type>::Reader {
+	private:
+		ConcurrentLinkedList &list;
+		alignas(64) std::atomic<std::uint64_t> seen; // own cache line, no false sharing
+	public:
+		explicit Reader(ConcurrentLinkedList &list) : list(list), seen(list.epoch.load(std::memory_order_acquire)) {
+			std::lock_guard<std::mutex> guard(list.readersLock);
+			list.readers.append(&seen);
+		}
+
+		Reader(const Reader &) = delete;
+
+		Reader &operator=(const Reader &) = delete;
+
+		~Reader() {
+			std::lock_guard<std::mutex> guard(list.readersLock);
+			std::atomic<std::uint64_t> *self = &seen;
+			list.readers.eraseIf([self](std::atomic<std::uint64_t> *reader) { return reader == self; });
+		}
+
+		// Announces that no iterators obtained before this call are still in use.
+		void quiescent() {
+			seen.store(list.epoch.load(std::memory_order_acquire), std::memory_order_release);
+		}
+
+		// While offline the reader must not touch the list at all.
+		void offline() {
+			seen.store(offlineEpoch, std::memory_order_release);
+		}
+
+		void online() {
+			seen.store(list.epoch.load(std::memory_order_acquire), std::memory_order_release);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_CONCURRENTLINKEDLIST_H
@@ -0,0 +1,304 @@
+#ifndef AISDI_LINEAR_FLATMAP_H
+#define AISDI_LINEAR_FLATMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "FlatSet.h"
+#include "Vector.h"
+
+namespace aisdi {
+
+	// Sorted map kept in two parallel Vectors: lookups only touch the key column.
+	template<typename Key, typename Value>
+	class FlatMap {
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using key_type = Key;
+		using mapped_type = Value;
+		using value_type = std::pair<Key, Value>;
+
+		class ConstIterator;
+
+		class Iterator;
+
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+	private:
+		Vector<Key> keys;
+		Vector<Value> values;
+
+		size_type indexOf(const Key &key) const {
+			return detail::lowerBoundIndex(keys.data(), keys.getSize(), key);
+		}
+
+		bool matches(size_type index, const Key &key) const {
+			return index != keys.getSize() && !(key < keys.data()[index]);
+		}
+
+		void insertAt(size_type index, const Key &key, const Value &value) {
+			keys.insert(keys.cbegin() + index, key);
+			values.insert(values.cbegin() + index, value);
+		}
+
+	public:
+		FlatMap() {}
+
+		FlatMap(std::initializer_list<value_type> l) {
+			insertRange(l.begin(), l.end());
+		}
+
+		bool isEmpty() const {
+			return keys.isEmpty();
+		}
+
+		size_type getSize() const {
+			return keys.getSize();
+		}
+
+		const_iterator lowerBound(const Key &key) const {
+			return const_iterator(this, indexOf(key));
+		}
+
+		iterator lowerBound(const Key &key) {
+			return iterator(const_iterator(this, indexOf(key)));
+		}
+
+		const_iterator find(const Key &key) const {
+			size_type index = indexOf(key);
+			return const_iterator(this, matches(index, key) ? index : getSize());
+		}
+
+		iterator find(const Key &key) {
+			return iterator(static_cast<const FlatMap &>(*this).find(key));
+		}
+
+		bool contains(const Key &key) const {
+			return matches(indexOf(key), key);
+		}
+
+		const Value &valueOf(const Key &key) const {
+			size_type index = indexOf(key);
+			if (!matches(index, key)) throw std::out_of_range("valueOf");
+			return values.data()[index];
+		}
+
+		Value &valueOf(const Key &key) {
+			return const_cast<Value &>(static_cast<const FlatMap &>(*this).valueOf(key));
+		}
+
+		Value &operator[](const Key &key) {
+			size_type index = indexOf(key);
+			if (!matches(index, key)) insertAt(index, key, Value());
+			return values.data()[index];
+		}
+
+		bool insert(const Key &key, const Value &value) {
+			size_type index = indexOf(key);
+			if (matches(index, key)) return false;
+			insertAt(index, key, value);
+			return true;
+		}
+
+		// Sorts the batch once and merges it with the current entries in a single
+		// pass. Like insert, an existing key keeps its value, and within the batch
+		// the first occurrence of a key wins.
+		template<typename InputIterator>
+		void insertRange(InputIterator first, InputIterator last) {
+			Vector<value_type> batch;
+			for (; first != last; ++first) {
+				const auto &entry = *first;
+				batch.append(value_type(entry.first, entry.second));
+			}
+			if (batch.isEmpty()) return;
+			value_type *batchBegin = batch.data();
+			value_type *batchEnd = batchBegin + batch.getSize();
+			std::stable_sort(batchBegin, batchEnd, [](const value_type &a, const value_type &b) {
+				return a.first < b.first;
+			});
+			batchEnd = std::unique(batchBegin, batchEnd, [](const value_type &a, const value_type &b) {
+				return !(a.first < b.first);
+			});
+
+			size_type mergedSize = keys.getSize() + (batchEnd - batchBegin);
+			Vector<Key> mergedKeys;
+			Vector<Value> mergedValues;
+			mergedKeys.ensureCapacity(mergedSize);
+			mergedValues.ensureCapacity(mergedSize);
+			size_type current = 0;
+			const value_type *incoming = batchBegin;
+			while (current != keys.getSize() && incoming != batchEnd) {
+				const Key &currentKey = keys.data()[current];
+				if (incoming->first < currentKey) {
+					mergedKeys.append(incoming->first);
+					mergedValues.append(incoming->second);
+					++incoming;
+				} else {
+					if (!(currentKey < incoming->first)) ++incoming;
+					mergedKeys.append(currentKey);
+					mergedValues.append(values.data()[current]);
+					++current;
+				}
+			}
+			for (; current != keys.getSize(); ++current) {
+				mergedKeys.append(keys.data()[current]);
+				mergedValues.append(values.data()[current]);
+			}
+			for (; incoming != batchEnd; ++incoming) {
+				mergedKeys.append(incoming->first);
+				mergedValues.append(incoming->second);
+			}
+			keys = std::move(mergedKeys);
+			values = std::move(mergedValues);
+		}
+
+		bool erase(const Key &key) {
+			size_type index = indexOf(key);
+			if (!matches(index, key)) return false;
+			keys.erase(keys.cbegin() + index);
+			values.erase(values.cbegin() + index);
+			return true;
+		}
+
+		void erase(const const_iterator &position) {
+			if (position.getIndex() >= getSize()) throw std::out_of_range("erase");
+			keys.erase(keys.cbegin() + position.getIndex());
+			values.erase(values.cbegin() + position.getIndex());
+		}
+
+		iterator begin() {
+			return iterator(ConstIterator(this, 0));
+		}
+
+		iterator end() {
+			return iterator(ConstIterator(this, getSize()));
+		}
+
+		const_iterator cbegin() const {
+			return const_iterator(this, 0);
+		}
+
+		const_iterator cend() const {
+			return const_iterator(this, getSize());
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+	template<typename Key, typename Value>
+	class FlatMap<Key, Value>::ConstIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = typename FlatMap::value_type;
+		using difference_type = typename FlatMap::difference_type;
+		using pointer = void;
+		using reference = std::pair<const Key &, const Value &>;
+	private:
+		const FlatMap *owner;
+		size_type index;
+	public:
+		explicit ConstIterator() : owner(nullptr), index(0) {}
+
+		ConstIterator(const FlatMap *owner, size_type index) : owner(owner), index(index) {}
+
+		const FlatMap *getOwner() const {
+			return owner;
+		}
+
+		size_type getIndex() const {
+			return index;
+		}
+
+		reference operator*() const {
+			if (index == owner->getSize()) throw std::out_of_range("op*");
+			return reference(owner->keys.data()[index], owner->values.data()[index]);
+		}
+
+		ConstIterator &operator++() {
+			if (index == owner->getSize()) throw std::out_of_range("++op");
+			index++;
+			return *this;
+		}
+
+		ConstIterator operator++(int) {
+			ConstIterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		ConstIterator &operator--() {
+			if (index == 0) throw std::out_of_range("--op");
+			index--;
+			return *this;
+		}
+
+		ConstIterator operator--(int) {
+			ConstIterator tmp = *this;
+			--(*this);
+			return tmp;
+		}
+
+		bool operator==(const ConstIterator &other) const {
+			return owner == other.owner && index == other.index;
+		}
+
+		bool operator!=(const ConstIterator &other) const {
+			return !(*this == other);
+		}
+	};
+
+	template<typename Key, typename Value>
+	class FlatMap<Key, Value>::Iterator : public FlatMap<Key, Value>::ConstIterator {
+	public:
+		using reference = std::pair<const Key &, Value &>;
+
+		explicit Iterator() {}
+
+		Iterator(const ConstIterator &other)
+				: ConstIterator(other) {}
+
+		Iterator &operator++() {
+			ConstIterator::operator++();
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			auto result = *this;
+			ConstIterator::operator++();
+			return result;
+		}
+
+		Iterator &operator--() {
+			ConstIterator::operator--();
+			return *this;
+		}
+
+		Iterator operator--(int) {
+			auto result = *this;
+			ConstIterator::operator--();
+			return result;
+		}
+
+		reference operator*() const {
+			auto entry = ConstIterator::operator*();
+			// ugly cast, yet reduces code duplication.
+			return reference(entry.first, const_cast<Value &>(entry.second));
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_FLATMAP_H
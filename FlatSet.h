@@ -0,0 +1,150 @@
+#ifndef AISDI_LINEAR_FLATSET_H
+#define AISDI_LINEAR_FLATSET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+	namespace detail {
+		// Branchless lower bound: the loop has a fixed trip count of log2(size) and
+		// the comparison only selects the next base, which compiles to a cmov.
+		template<typename Key>
+		std::size_t lowerBoundIndex(const Key *first, std::size_t size, const Key &key) {
+			if (size == 0) return 0;
+			const Key *base = first;
+			while (size > 1) {
+				std::size_t half = size / 2;
+				base = (base[half] < key) ? base + half : base;
+				size -= half;
+			}
+			return (base - first) + (*base < key);
+		}
+	}
+
+	// Sorted set of unique keys kept in one contiguous Vector.
+	template<typename Key>
+	class FlatSet {
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using key_type = Key;
+		using value_type = Key;
+		using const_pointer = const Key *;
+		using const_reference = const Key &;
+
+		using const_iterator = typename Vector<Key>::ConstIterator;
+		using iterator = const_iterator;
+
+	private:
+		Vector<Key> keys;
+
+		const_iterator at(size_type index) const {
+			return keys.cbegin() + index;
+		}
+
+		size_type indexOf(const Key &key) const {
+			return detail::lowerBoundIndex(keys.data(), keys.getSize(), key);
+		}
+
+	public:
+		FlatSet() {}
+
+		FlatSet(std::initializer_list<Key> l) {
+			insertRange(l.begin(), l.end());
+		}
+
+		bool isEmpty() const {
+			return keys.isEmpty();
+		}
+
+		size_type getSize() const {
+			return keys.getSize();
+		}
+
+		const_iterator lowerBound(const Key &key) const {
+			return at(indexOf(key));
+		}
+
+		const_iterator find(const Key &key) const {
+			size_type index = indexOf(key);
+			if (index == keys.getSize() || key < keys.data()[index]) return cend();
+			return at(index);
+		}
+
+		bool contains(const Key &key) const {
+			return find(key) != cend();
+		}
+
+		bool insert(const Key &key) {
+			size_type index = indexOf(key);
+			if (index != keys.getSize() && !(key < keys.data()[index])) return false;
+			keys.insert(at(index), key);
+			return true;
+		}
+
+		// Sorts the batch once and merges it with the current keys in a single
+		// pass, instead of shifting the tail for every inserted key.
+		template<typename InputIterator>
+		void insertRange(InputIterator first, InputIterator last) {
+			Vector<Key> batch;
+			for (; first != last; ++first) batch.append(*first);
+			if (batch.isEmpty()) return;
+			Key *batchBegin = batch.data();
+			Key *batchEnd = batchBegin + batch.getSize();
+			std::sort(batchBegin, batchEnd);
+			batchEnd = std::unique(batchBegin, batchEnd, [](const Key &a, const Key &b) { return !(a < b); });
+
+			Vector<Key> merged;
+			merged.ensureCapacity(keys.getSize() + (batchEnd - batchBegin));
+			const Key *current = keys.data();
+			const Key *currentEnd = current + keys.getSize();
+			const Key *incoming = batchBegin;
+			while (current != currentEnd && incoming != batchEnd) {
+				if (*incoming < *current) {
+					merged.append(*incoming++);
+				} else {
+					if (!(*current < *incoming)) ++incoming;
+					merged.append(*current++);
+				}
+			}
+			for (; current != currentEnd; ++current) merged.append(*current);
+			for (; incoming != batchEnd; ++incoming) merged.append(*incoming);
+			keys = std::move(merged);
+		}
+
+		bool erase(const Key &key) {
+			const_iterator position = find(key);
+			if (position == cend()) return false;
+			keys.erase(position);
+			return true;
+		}
+
+		void erase(const const_iterator &position) {
+			keys.erase(position);
+		}
+
+		const_iterator cbegin() const {
+			return keys.cbegin();
+		}
+
+		const_iterator cend() const {
+			return keys.cend();
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_FLATSET_H
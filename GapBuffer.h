@@ -0,0 +1,382 @@
+#ifndef AISDI_LINEAR_GAPBUFFER_H
+#define AISDI_LINEAR_GAPBUFFER_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi {
+
+	// Contiguous sequence with a movable gap at the cursor. Elements before the
+	// cursor sit at the front of the buffer, the rest at its back:
+	//
+	//   [0, gapBegin) elements | [gapBegin, gapEnd) gap | [gapEnd, capacity) elements
+	//
+	// Inserting or erasing at the cursor only resizes the gap. Moving the cursor
+	// shifts just the elements it passes over.
+	template<typename Type>
+	class GapBuffer {
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = Type;
+		using pointer = Type *;
+		using reference = Type &;
+		using const_pointer = const Type *;
+		using const_reference = const Type &;
+
+		class ConstIterator;
+
+		class Iterator;
+
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+	private:
+		pointer buffer;
+		size_type capacity;
+		size_type gapBegin;
+		size_type gapEnd;
+
+		size_type physical(size_type index) const {
+			return index < gapBegin ? index : index + (gapEnd - gapBegin);
+		}
+
+		void grow() {
+			size_type size = getSize();
+			size_type newCapacity = capacity < 8 ? 16 : capacity * 2;
+			pointer tmp = buffer;
+			buffer = new Type[newCapacity];
+			for (size_type i = 0; i < gapBegin; i++) {
+				*(buffer + i) = std::move(*(tmp + i));
+			}
+			size_type tailSize = capacity - gapEnd;
+			for (size_type i = 0; i < tailSize; i++) {
+				*(buffer + newCapacity - tailSize + i) = std::move(*(tmp + gapEnd + i));
+			}
+			delete[](tmp);
+			capacity = newCapacity;
+			gapEnd = gapBegin + (newCapacity - size);
+		}
+
+		size_type indexOf(const const_iterator &position) const {
+			if (position.getOwner() != this || position.getIndex() > getSize()) throw std::out_of_range("position");
+			return position.getIndex();
+		}
+
+	public:
+		GapBuffer() : buffer(nullptr), capacity(0), gapBegin(0), gapEnd(0) {}
+
+		GapBuffer(std::initializer_list<Type> l) : GapBuffer() {
+			for (auto it = l.begin(); it != l.end(); ++it) {
+				append(*it);
+			}
+		}
+
+		GapBuffer(const GapBuffer &other) : GapBuffer() {
+			for (auto it = other.begin(); it != other.end(); ++it) {
+				append(*it);
+			}
+		}
+
+		GapBuffer(GapBuffer &&other) noexcept
+				: buffer(other.buffer), capacity(other.capacity), gapBegin(other.gapBegin), gapEnd(other.gapEnd) {
+			other.buffer = nullptr;
+			other.capacity = 0;
+			other.gapBegin = 0;
+			other.gapEnd = 0;
+		}
+
+		~GapBuffer() {
+			delete[](buffer);
+		}
+
+		GapBuffer &operator=(const GapBuffer &other) {
+			if (this == &other) return *this;
+			GapBuffer tmp(other);
+			*this = std::move(tmp);
+			return *this;
+		}
+
+		GapBuffer &operator=(GapBuffer &&other) noexcept {
+			if (this == &other) return *this;
+			delete[](buffer);
+			buffer = other.buffer;
+			capacity = other.capacity;
+			gapBegin = other.gapBegin;
+			gapEnd = other.gapEnd;
+			other.buffer = nullptr;
+			other.capacity = 0;
+			other.gapBegin = 0;
+			other.gapEnd = 0;
+			return *this;
+		}
+
+		bool isEmpty() const {
+			return getSize() == 0;
+		}
+
+		size_type getSize() const {
+			return capacity - (gapEnd - gapBegin);
+		}
+
+		size_type getCursor() const {
+			return gapBegin;
+		}
+
+		// O(|position - cursor|): only the elements between the old and the new
+		// cursor cross the gap.
+		void setCursor(size_type position) {
+			if (position > getSize()) throw std::out_of_range("setCursor");
+			if (gapBegin == gapEnd) {
+				// an empty gap can sit anywhere; moving elements would self-assign
+				gapBegin = gapEnd = position;
+				return;
+			}
+			while (gapBegin > position) {
+				*(buffer + --gapEnd) = std::move(*(buffer + --gapBegin));
+			}
+			while (gapBegin < position) {
+				*(buffer + gapBegin++) = std::move(*(buffer + gapEnd++));
+			}
+		}
+
+		void insertAtCursor(const Type &item) {
+			insertAtCursor(Type(item));
+		}
+
+		void insertAtCursor(Type &&item) {
+			if (gapBegin == gapEnd) grow();
+			*(buffer + gapBegin++) = std::move(item);
+		}
+
+		// Removes the element just before the cursor, like backspace.
+		void eraseBeforeCursor() {
+			if (gapBegin == 0) throw std::out_of_range("eraseBeforeCursor");
+			gapBegin--;
+		}
+
+		// Removes the element just after the cursor, like delete.
+		void eraseAfterCursor() {
+			if (gapEnd == capacity) throw std::out_of_range("eraseAfterCursor");
+			gapEnd++;
+		}
+
+		reference operator[](size_type index) {
+			return const_cast<reference>(static_cast<const GapBuffer &>(*this)[index]);
+		}
+
+		const_reference operator[](size_type index) const {
+			if (index >= getSize()) throw std::out_of_range("op[]");
+			return *(buffer + physical(index));
+		}
+
+		void append(const Type &item) {
+			insert(cend(), Type(item));
+		}
+
+		void append(Type &&item) {
+			insert(cend(), std::move(item));
+		}
+
+		void prepend(const Type &item) {
+			insert(cbegin(), Type(item));
+		}
+
+		void prepend(Type &&item) {
+			insert(cbegin(), std::move(item));
+		}
+
+		// Moves the cursor to the position and inserts there; the cursor ends up
+		// after the new element.
+		void insert(const const_iterator &insertPosition, const Type &item) {
+			insert(insertPosition, Type(item));
+		}
+
+		void insert(const const_iterator &insertPosition, Type &&item) {
+			setCursor(indexOf(insertPosition));
+			insertAtCursor(std::move(item));
+		}
+
+		Type popFirst() {
+			if (isEmpty()) throw std::logic_error("popFirst");
+			setCursor(0);
+			return std::move(*(buffer + gapEnd++));
+		}
+
+		Type popLast() {
+			if (isEmpty()) throw std::logic_error("popLast");
+			setCursor(getSize());
+			return std::move(*(buffer + --gapBegin));
+		}
+
+		void erase(const const_iterator &position) {
+			size_type index = indexOf(position);
+			if (index == getSize()) throw std::out_of_range("erase");
+			setCursor(index);
+			gapEnd++;
+		}
+
+		void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+			size_type first = indexOf(firstIncluded);
+			size_type last = indexOf(lastExcluded);
+			if (first > last) throw std::out_of_range("erase");
+			setCursor(first);
+			gapEnd += last - first;
+		}
+
+		iterator begin() {
+			return iterator(ConstIterator(this, 0));
+		}
+
+		iterator end() {
+			return iterator(ConstIterator(this, getSize()));
+		}
+
+		const_iterator cbegin() const {
+			return const_iterator(this, 0);
+		}
+
+		const_iterator cend() const {
+			return const_iterator(this, getSize());
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+	template<typename Type>
+	class GapBuffer<Type>::ConstIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = typename GapBuffer::value_type;
+		using difference_type = typename GapBuffer::difference_type;
+		using pointer = typename GapBuffer::const_pointer;
+		using reference = typename GapBuffer::const_reference;
+	private:
+		const GapBuffer *owner;
+		size_type index;
+	public:
+		explicit ConstIterator() : owner(nullptr), index(0) {}
+
+		ConstIterator(const GapBuffer *owner, size_type index) : owner(owner), index(index) {}
+
+		const GapBuffer *getOwner() const {
+			return owner;
+		}
+
+		size_type getIndex() const {
+			return index;
+		}
+
+		reference operator*() const {
+			if (index == owner->getSize()) throw std::out_of_range("op*");
+			return *(owner->buffer + owner->physical(index));
+		}
+
+		ConstIterator &operator++() {
+			if (index == owner->getSize()) throw std::out_of_range("++op");
+			index++;
+			return *this;
+		}
+
+		ConstIterator operator++(int) {
+			ConstIterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		ConstIterator &operator--() {
+			if (index == 0) throw std::out_of_range("--op");
+			index--;
+			return *this;
+		}
+
+		ConstIterator operator--(int) {
+			ConstIterator tmp = *this;
+			--(*this);
+			return tmp;
+		}
+
+		ConstIterator operator+(difference_type d) const {
+			ConstIterator tmp = *this;
+			if (static_cast<difference_type>(index) + d > static_cast<difference_type>(owner->getSize()))
+				throw std::out_of_range("op+");
+			tmp.index += d;
+			return tmp;
+		}
+
+		ConstIterator operator-(difference_type d) const {
+			ConstIterator tmp = *this;
+			if (static_cast<difference_type>(index) - d < 0) throw std::out_of_range("op-");
+			tmp.index -= d;
+			return tmp;
+		}
+
+		bool operator==(const ConstIterator &other) const {
+			return owner == other.owner && index == other.index;
+		}
+
+		bool operator!=(const ConstIterator &other) const {
+			return !(*this == other);
+		}
+	};
+
+	template<typename Type>
+	class GapBuffer<Type>::Iterator : public GapBuffer<Type>::ConstIterator {
+	public:
+		using pointer = typename GapBuffer::pointer;
+		using reference = typename GapBuffer::reference;
+
+		explicit Iterator() {}
+
+		Iterator(const ConstIterator &other)
+				: ConstIterator(other) {}
+
+		Iterator &operator++() {
+			ConstIterator::operator++();
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			auto result = *this;
+			ConstIterator::operator++();
+			return result;
+		}
+
+		Iterator &operator--() {
+			ConstIterator::operator--();
+			return *this;
+		}
+
+		Iterator operator--(int) {
+			auto result = *this;
+			ConstIterator::operator--();
+			return result;
+		}
+
+		Iterator operator+(difference_type d) const {
+			return ConstIterator::operator+(d);
+		}
+
+		Iterator operator-(difference_type d) const {
+			return ConstIterator::operator-(d);
+		}
+
+		reference operator*() const {
+			// ugly cast, yet reduces code duplication.
+			return const_cast<reference>(ConstIterator::operator*());
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_GAPBUFFER_H
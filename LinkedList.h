@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
+#include <utility>
 
 namespace aisdi {
 
@@ -17,11 +18,86 @@ namespace aisdi {
 
 			Node(const Type &value) : data(value), next(nullptr), prev(nullptr) {}
 
+			Node(Type &&value) : data(std::move(value)), next(nullptr), prev(nullptr) {}
+
 			Node() : next(nullptr), prev(nullptr) {}
 		};
 
+		// The end sentinel lives inside the list, so moving a list never has to
+		// allocate a fresh sentinel for the moved-from object.
+		Node sentinel;
 		Node *head, *tail;
 
+		void unlink(Node *node) {
+			if (node->prev == nullptr) head = node->next;
+			else node->prev->next = node->next;
+			node->next->prev = node->prev;
+		}
+
+		void linkLast(Node *newNode) {
+			if (isEmpty()) {
+				head = newNode;
+				newNode->next = tail;
+				tail->prev = newNode;
+				tail->next = nullptr;
+			} else {
+				tail->prev->next = newNode;
+				newNode->next = tail;
+				newNode->prev = tail->prev;
+				tail->prev = newNode;
+			}
+			size++;
+		}
+
+		void linkFirst(Node *newNode) {
+			if (isEmpty()) {
+				head = newNode;
+				newNode->next = tail;
+				tail->prev = newNode;
+				tail->next = nullptr;
+			} else {
+				head->prev = newNode;
+				newNode->next = head;
+				head = newNode;
+			}
+			size++;
+		}
+
+		void linkBefore(Node *position, Node *newNode) {
+			if (position == head) {
+				linkFirst(newNode);
+				return;
+			}
+			position->prev->next = newNode;
+			newNode->prev = position->prev;
+			position->prev = newNode;
+			newNode->next = position;
+			size++;
+		}
+
+		void clear() {
+			for (Node *pos = head; pos != tail;) {
+				Node *next = pos->next;
+				delete (pos);
+				pos = next;
+			}
+			head = tail;
+			tail->prev = nullptr;
+			size = 0;
+		}
+
+		void takeNodes(LinkedList &other) noexcept {
+			if (!other.isEmpty()) {
+				head = other.head;
+				tail->prev = other.tail->prev;
+				tail->prev->next = tail;
+				other.head = other.tail;
+				other.tail->prev = nullptr;
+			}
+			size = other.size;
+			other.size = 0;
+		}
+
 	public:
 		using difference_type = std::ptrdiff_t;
 		using size_type = std::size_t;
@@ -39,63 +115,38 @@ namespace aisdi {
 		using const_iterator = ConstIterator;
 		size_type size = 0;
 
-		LinkedList() {
-			Node *sentinel = new Node();
-			head = sentinel;
-			tail = sentinel;
-		}
+		LinkedList() : head(&sentinel), tail(&sentinel) {}
 
-		LinkedList(std::initializer_list<Type> l) {
-			Node *sentinel = new Node();
-			head = sentinel;
-			tail = sentinel;
+		LinkedList(std::initializer_list<Type> l) : head(&sentinel), tail(&sentinel) {
 			for (auto it = l.begin(); it != l.end(); ++it)
 				append(*it);
 		}
 
-		LinkedList(const LinkedList &other) {
-			Node *sentinel = new Node();
-			head = sentinel;
-			tail = sentinel;
+		LinkedList(const LinkedList &other) : head(&sentinel), tail(&sentinel) {
 			for (auto it = other.begin(); it != other.end(); ++it) {
 				append(*it);
 			}
 		}
 
-		LinkedList(LinkedList &&other) : head(other.head), tail(other.tail), size(other.size) {
-			other.head = nullptr;
-			other.tail = nullptr;
-			other.size = 0;
+		LinkedList(LinkedList &&other) noexcept : head(&sentinel), tail(&sentinel) {
+			takeNodes(other);
 		}
 
 		~LinkedList() {
-			if (head != tail) {
-				auto tmp = head;
-				for (auto pos = head->next; pos != tail->next; pos = pos->next) {
-					tmp = pos->prev;
-					delete (tmp);
-				}
-			}
-			delete (tail);
+			clear();
 		}
 
 		LinkedList &operator=(const LinkedList &other) {
 			if (this == &other) return *this;
-			erase(this->begin(), this->end());
+			clear();
 			for (auto it = other.begin(); it != other.end(); ++it) append(*it);
 			return *this;
 		}
 
-		LinkedList &operator=(LinkedList &&other) {
+		LinkedList &operator=(LinkedList &&other) noexcept {
 			if (this == &other) return *this;
-			erase(this->begin(), this->end());
-			delete (tail);
-			head = other.head;
-			tail = other.tail;
-			size = other.size;
-			other.head = nullptr;
-			other.tail = nullptr;
-			other.size = 0;
+			clear();
+			takeNodes(other);
 			return *this;
 		}
 
@@ -108,59 +159,36 @@ namespace aisdi {
 		}
 
 		void append(const Type &item) {
+			linkLast(new Node(item));
+		}
 
-			Node *newNode = new Node(item);
-			if (isEmpty()) {
-				head = newNode;
-				newNode->next = tail;
-				tail->prev = newNode;
-				tail->next = nullptr;
-			} else {
-				tail->prev->next = newNode;
-				newNode->next = tail;
-				newNode->prev = tail->prev;
-				tail->prev = newNode;
-			}
-			size++;
-			return;
+		void append(Type &&item) {
+			linkLast(new Node(std::move(item)));
 		}
 
 		void prepend(const Type &item) {
-			Node *newNode = new Node(item);
-			if (isEmpty()) {
-				head = newNode;
-				newNode->next = tail;
-				tail->prev = newNode;
-				tail->next = nullptr;
-			} else {
-				head->prev = newNode;
-				newNode->next = head;
-				head = newNode;
-			}
-			size++;
-			return;
+			linkFirst(new Node(item));
+		}
+
+		void prepend(Type &&item) {
+			linkFirst(new Node(std::move(item)));
 		}
 
 		void insert(const const_iterator &insertPosition, const Type &item) {
-			if (insertPosition.getCurrent() == head) {
-				prepend(item);
-				return;
-			}
-			Node *newNode = new Node(item);
-			insertPosition.getCurrent()->prev->next = newNode;
-			newNode->prev = insertPosition.getCurrent()->prev;
-			insertPosition.getCurrent()->prev = newNode;
-			newNode->next = insertPosition.getCurrent();
-			size++;
-			return;
+			linkBefore(insertPosition.getCurrent(), new Node(item));
+		}
+
+		void insert(const const_iterator &insertPosition, Type &&item) {
+			linkBefore(insertPosition.getCurrent(), new Node(std::move(item)));
 		}
 
 		Type popFirst() {
 			if (isEmpty()) throw std::out_of_range("popFirst");
-			Type tmpData = head->data;
+			Type tmpData = std::move(head->data);
 			Node *tmp = head->next;
 			delete (head);
 			head = tmp;
+			head->prev = nullptr;
 			size--;
 			return tmpData;
 		}
@@ -168,9 +196,10 @@ namespace aisdi {
 		Type popLast() {
 			if (isEmpty()) throw std::out_of_range("popLast");
 			Node *tmp = tail->prev;
-			Type tmpData = tmp->data;
+			Type tmpData = std::move(tmp->data);
 			tail->prev = tail->prev->prev;
 			if (tail->prev != nullptr) tail->prev->next = tail;
+			else head = tail;
 			delete (tmp);
 			size--;
 			return tmpData;
@@ -219,6 +248,45 @@ namespace aisdi {
 
 		}
 
+		// Unlinks every match in one traversal. Each node is freed right after
+		// unlinking, while it is still in cache.
+		template<typename Predicate>
+		size_type eraseIf(Predicate predicate) {
+			size_type count = 0;
+			for (Node *pos = head; pos != tail;) {
+				Node *next = pos->next;
+				if (predicate(pos->data)) {
+					unlink(pos);
+					delete (pos);
+					size--;
+					count++;
+				}
+				pos = next;
+			}
+			return count;
+		}
+
+		size_type removeValue(const Type &value) {
+			const Type copy = value; // value may alias a node that gets freed
+			return eraseIf([&copy](const Type &item) { return item == copy; });
+		}
+
+		size_type unique() {
+			if (size < 2) return 0;
+			size_type count = 0;
+			for (Node *pos = head->next; pos != tail;) {
+				Node *next = pos->next;
+				if (pos->data == pos->prev->data) {
+					unlink(pos);
+					delete (pos);
+					size--;
+					count++;
+				}
+				pos = next;
+			}
+			return count;
+		}
+
 		iterator begin() {
 			return iterator(head);
 		}
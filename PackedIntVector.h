@@ -0,0 +1,357 @@
+#ifndef AISDI_LINEAR_PACKEDINTVECTOR_H
+#define AISDI_LINEAR_PACKEDINTVECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+	// Unsigned integers stored in exactly Bits bits each, packed back to back
+	// into 64-bit words; a value may straddle two words.
+	template<unsigned Bits>
+	class PackedIntVector {
+		static_assert(Bits >= 1 && Bits <= 64, "Bits must be in [1, 64]");
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = std::uint64_t;
+		using word_type = std::uint64_t;
+
+		class ConstIterator;
+
+		using iterator = ConstIterator;
+		using const_iterator = ConstIterator;
+
+		static constexpr value_type maxValue = Bits == 64 ? ~value_type(0) : (value_type(1) << Bits) - 1;
+
+	private:
+		Vector<word_type> words;
+		size_type size;
+
+		static size_type wordsFor(size_type count) {
+			return (count * Bits + 63) / 64;
+		}
+
+	public:
+		PackedIntVector() : size(0) {}
+
+		PackedIntVector(std::initializer_list<value_type> l) : size(0) {
+			words.ensureCapacity(wordsFor(l.size()));
+			for (auto it = l.begin(); it != l.end(); ++it) append(*it);
+		}
+
+		bool isEmpty() const {
+			return size == 0;
+		}
+
+		size_type getSize() const {
+			return size;
+		}
+
+		size_type getWordCount() const {
+			return words.getSize();
+		}
+
+		value_type operator[](size_type index) const {
+			if (index >= size) throw std::out_of_range("op[]");
+			const word_type *word = words.data();
+			size_type bit = index * Bits;
+			size_type offset = bit % 64;
+			value_type value = word[bit / 64] >> offset;
+			if (offset + Bits > 64) value |= word[bit / 64 + 1] << (64 - offset);
+			return value & maxValue;
+		}
+
+		void set(size_type index, value_type value) {
+			if (index >= size) throw std::out_of_range("set");
+			if (value > maxValue) throw std::out_of_range("set");
+			word_type *word = words.data();
+			size_type bit = index * Bits;
+			size_type offset = bit % 64;
+			word[bit / 64] = (word[bit / 64] & ~(maxValue << offset)) | (value << offset);
+			if (offset + Bits > 64) {
+				size_type spill = offset + Bits - 64;
+				word_type mask = (word_type(1) << spill) - 1;
+				word[bit / 64 + 1] = (word[bit / 64 + 1] & ~mask) | (value >> (64 - offset));
+			}
+		}
+
+		void append(value_type value) {
+			if (value > maxValue) throw std::out_of_range("append");
+			size++;
+			while (words.getSize() < wordsFor(size)) words.append(0);
+			set(size - 1, value);
+		}
+
+		value_type popLast() {
+			if (size == 0) throw std::logic_error("popLast");
+			value_type value = (*this)[size - 1];
+			set(size - 1, 0);
+			size--;
+			while (words.getSize() > wordsFor(size)) words.popLast();
+			return value;
+		}
+
+		const_iterator cbegin() const {
+			return const_iterator(this, 0);
+		}
+
+		const_iterator cend() const {
+			return const_iterator(this, size);
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+	template<unsigned Bits>
+	class PackedIntVector<Bits>::ConstIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = typename PackedIntVector::value_type;
+		using difference_type = typename PackedIntVector::difference_type;
+		using pointer = void;
+		using reference = value_type;
+	private:
+		const PackedIntVector *owner;
+		size_type index;
+	public:
+		explicit ConstIterator() : owner(nullptr), index(0) {}
+
+		ConstIterator(const PackedIntVector *owner, size_type index) : owner(owner), index(index) {}
+
+		size_type getIndex() const {
+			return index;
+		}
+
+		reference operator*() const {
+			if (index == owner->size) throw std::out_of_range("op*");
+			return (*owner)[index];
+		}
+
+		ConstIterator &operator++() {
+			if (index == owner->size) throw std::out_of_range("++op");
+			index++;
+			return *this;
+		}
+
+		ConstIterator operator++(int) {
+			ConstIterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		ConstIterator &operator--() {
+			if (index == 0) throw std::out_of_range("--op");
+			index--;
+			return *this;
+		}
+
+		ConstIterator operator--(int) {
+			ConstIterator tmp = *this;
+			--(*this);
+			return tmp;
+		}
+
+		bool operator==(const ConstIterator &other) const {
+			return owner == other.owner && index == other.index;
+		}
+
+		bool operator!=(const ConstIterator &other) const {
+			return !(*this == other);
+		}
+	};
+
+	// Append-only integer sequence for sorted or slowly changing ids. Values are
+	// grouped in blocks of BlockSize: the first value of a block is stored whole,
+	// the rest as zigzag-encoded deltas in LEB128 varints. Random access decodes
+	// at most one block; iteration decodes each varint exactly once.
+	template<std::size_t BlockSize = 128>
+	class DeltaPackedIntVector {
+		static_assert(BlockSize >= 1, "BlockSize must be positive");
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = std::uint64_t;
+
+		class ConstIterator;
+
+		using iterator = ConstIterator;
+		using const_iterator = ConstIterator;
+
+	private:
+		Vector<value_type> blockFirst;
+		Vector<size_type> blockOffset;
+		Vector<std::uint8_t> bytes;
+		value_type last;
+		size_type size;
+
+		static value_type zigzag(value_type current, value_type previous) {
+			value_type delta = current - previous;
+			return (delta << 1) ^ (0 - (delta >> 63));
+		}
+
+		static value_type unzigzag(value_type encoded) {
+			return (encoded >> 1) ^ (0 - (encoded & 1));
+		}
+
+		// Decodes the varint at `position` and advances past it.
+		static value_type readVarint(const std::uint8_t *&position) {
+			value_type value = 0;
+			unsigned shift = 0;
+			std::uint8_t byte;
+			do {
+				byte = *position++;
+				value |= value_type(byte & 0x7f) << shift;
+				shift += 7;
+			} while (byte & 0x80);
+			return value;
+		}
+
+	public:
+		DeltaPackedIntVector() : last(0), size(0) {}
+
+		DeltaPackedIntVector(std::initializer_list<value_type> l) : last(0), size(0) {
+			for (auto it = l.begin(); it != l.end(); ++it) append(*it);
+		}
+
+		bool isEmpty() const {
+			return size == 0;
+		}
+
+		size_type getSize() const {
+			return size;
+		}
+
+		size_type getEncodedBytes() const {
+			return bytes.getSize() + blockFirst.getSize() * (sizeof(value_type) + sizeof(size_type));
+		}
+
+		void append(value_type value) {
+			if (size % BlockSize == 0) {
+				blockFirst.append(value);
+				blockOffset.append(bytes.getSize());
+			} else {
+				value_type encoded = zigzag(value, last);
+				while (encoded >= 0x80) {
+					bytes.append(static_cast<std::uint8_t>(encoded | 0x80));
+					encoded >>= 7;
+				}
+				bytes.append(static_cast<std::uint8_t>(encoded));
+			}
+			last = value;
+			size++;
+		}
+
+		value_type operator[](size_type index) const {
+			if (index >= size) throw std::out_of_range("op[]");
+			size_type block = index / BlockSize;
+			value_type value = blockFirst.data()[block];
+			const std::uint8_t *position = bytes.data() + blockOffset.data()[block];
+			for (size_type i = block * BlockSize; i < index; i++) value += unzigzag(readVarint(position));
+			return value;
+		}
+
+		const_iterator cbegin() const {
+			return const_iterator(this, 0);
+		}
+
+		const_iterator cend() const {
+			return const_iterator(this, size);
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+	template<std::size_t BlockSize>
+	class DeltaPackedIntVector<BlockSize>::ConstIterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = typename DeltaPackedIntVector::value_type;
+		using difference_type = typename DeltaPackedIntVector::difference_type;
+		using pointer = void;
+		using reference = value_type;
+	private:
+		const DeltaPackedIntVector *owner;
+		size_type index;
+		value_type current;
+		const std::uint8_t *position;
+
+		void load() {
+			if (index == owner->size) return;
+			if (index % BlockSize == 0) {
+				size_type block = index / BlockSize;
+				current = owner->blockFirst.data()[block];
+				position = owner->bytes.data() + owner->blockOffset.data()[block];
+			} else {
+				current += unzigzag(readVarint(position));
+			}
+		}
+
+	public:
+		explicit ConstIterator() : owner(nullptr), index(0), current(0), position(nullptr) {}
+
+		ConstIterator(const DeltaPackedIntVector *owner, size_type index)
+				: owner(owner), index(index), current(0), position(nullptr) {
+			if (index < owner->size && index % BlockSize != 0) {
+				current = (*owner)[index];
+				size_type block = index / BlockSize;
+				position = owner->bytes.data() + owner->blockOffset.data()[block];
+				for (size_type i = block * BlockSize; i < index; i++) readVarint(position);
+			} else {
+				load();
+			}
+		}
+
+		size_type getIndex() const {
+			return index;
+		}
+
+		reference operator*() const {
+			if (index == owner->size) throw std::out_of_range("op*");
+			return current;
+		}
+
+		ConstIterator &operator++() {
+			if (index == owner->size) throw std::out_of_range("++op");
+			index++;
+			load();
+			return *this;
+		}
+
+		ConstIterator operator++(int) {
+			ConstIterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		bool operator==(const ConstIterator &other) const {
+			return owner == other.owner && index == other.index;
+		}
+
+		bool operator!=(const ConstIterator &other) const {
+			return !(*this == other);
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_PACKEDINTVECTOR_H
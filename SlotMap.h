@@ -0,0 +1,209 @@
+#ifndef AISDI_LINEAR_SLOTMAP_H
+#define AISDI_LINEAR_SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+	// Unordered container addressed by generational handles. Values are kept
+	// densely packed in a Vector; a slot table maps each handle to its current
+	// dense position. Erase moves the last value into the hole, so insert, erase
+	// and lookup are O(1) and iteration runs over a plain array. A handle stays
+	// valid until its value is erased; after that the slot's generation has
+	// moved on and the stale handle is rejected. Handles carry no map identity,
+	// so a handle from another SlotMap is only rejected if it hits no live slot.
+	template<typename Type>
+	class SlotMap {
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = Type;
+		using pointer = Type *;
+		using reference = Type &;
+		using const_pointer = const Type *;
+		using const_reference = const Type &;
+
+		using iterator = typename Vector<Type>::Iterator;
+		using const_iterator = typename Vector<Type>::ConstIterator;
+
+		class Handle {
+		public:
+			std::uint32_t index;
+			std::uint32_t generation;
+
+			Handle() : index(invalidIndex), generation(0) {}
+
+			Handle(std::uint32_t index, std::uint32_t generation) : index(index), generation(generation) {}
+
+			bool operator==(const Handle &other) const {
+				return index == other.index && generation == other.generation;
+			}
+
+			bool operator!=(const Handle &other) const {
+				return !(*this == other);
+			}
+		};
+
+	private:
+		static constexpr std::uint32_t invalidIndex = ~std::uint32_t(0);
+
+		// For a live slot `index` is the dense position of its value; for a free
+		// slot it links to the next free slot. The generation is bumped on both
+		// insert and erase, so it is odd exactly while the slot is live.
+		class Slot {
+		public:
+			std::uint32_t index;
+			std::uint32_t generation;
+
+			Slot() : index(invalidIndex), generation(0) {}
+		};
+
+		Vector<Type> values;
+		Vector<std::uint32_t> denseToSlot;
+		Vector<Slot> slots;
+		std::uint32_t freeHead;
+
+		const Slot *slotOf(const Handle &handle) const {
+			if (handle.index >= slots.getSize()) return nullptr;
+			const Slot *slot = slots.data() + handle.index;
+			if (slot->generation != handle.generation || (slot->generation & 1) == 0) return nullptr;
+			return slot;
+		}
+
+		std::uint32_t acquireSlot() {
+			if (freeHead != invalidIndex) {
+				std::uint32_t slot = freeHead;
+				freeHead = slots.data()[slot].index;
+				return slot;
+			}
+			if (slots.getSize() == invalidIndex) throw std::length_error("SlotMap");
+			slots.append(Slot());
+			return static_cast<std::uint32_t>(slots.getSize() - 1);
+		}
+
+		Handle link(std::uint32_t slot) {
+			denseToSlot.append(slot);
+			slots.data()[slot].index = static_cast<std::uint32_t>(values.getSize() - 1);
+			slots.data()[slot].generation++;
+			return Handle(slot, slots.data()[slot].generation);
+		}
+
+	public:
+		SlotMap() : freeHead(invalidIndex) {}
+
+		bool isEmpty() const {
+			return values.isEmpty();
+		}
+
+		size_type getSize() const {
+			return values.getSize();
+		}
+
+		pointer data() {
+			return values.data();
+		}
+
+		const_pointer data() const {
+			return values.data();
+		}
+
+		Handle insert(const Type &item) {
+			return insert(Type(item));
+		}
+
+		Handle insert(Type &&item) {
+			std::uint32_t slot = acquireSlot();
+			try {
+				values.append(std::move(item));
+			} catch (...) {
+				slots.data()[slot].index = freeHead;
+				freeHead = slot;
+				throw;
+			}
+			return link(slot);
+		}
+
+		bool contains(const Handle &handle) const {
+			return slotOf(handle) != nullptr;
+		}
+
+		// Returns nullptr for a stale handle or one that names no live slot.
+		const_pointer find(const Handle &handle) const {
+			const Slot *slot = slotOf(handle);
+			return slot == nullptr ? nullptr : values.data() + slot->index;
+		}
+
+		pointer find(const Handle &handle) {
+			return const_cast<pointer>(static_cast<const SlotMap &>(*this).find(handle));
+		}
+
+		const_reference operator[](const Handle &handle) const {
+			const_pointer item = find(handle);
+			if (item == nullptr) throw std::out_of_range("op[]");
+			return *item;
+		}
+
+		reference operator[](const Handle &handle) {
+			return const_cast<reference>(static_cast<const SlotMap &>(*this)[handle]);
+		}
+
+		// Handle of the value at a dense position, e.g. while iterating.
+		Handle handleAt(size_type denseIndex) const {
+			if (denseIndex >= values.getSize()) throw std::out_of_range("handleAt");
+			std::uint32_t slot = denseToSlot.data()[denseIndex];
+			return Handle(slot, slots.data()[slot].generation);
+		}
+
+		bool erase(const Handle &handle) {
+			if (slotOf(handle) == nullptr) return false;
+			Slot &slot = slots.data()[handle.index];
+			std::uint32_t dense = slot.index;
+			std::uint32_t last = static_cast<std::uint32_t>(values.getSize() - 1);
+			if (dense != last) {
+				values.data()[dense] = std::move(values.data()[last]);
+				std::uint32_t movedSlot = denseToSlot.data()[last];
+				denseToSlot.data()[dense] = movedSlot;
+				slots.data()[movedSlot].index = dense;
+			}
+			values.popLast();
+			denseToSlot.popLast();
+			slot.generation++;
+			slot.index = freeHead;
+			freeHead = handle.index;
+			return true;
+		}
+
+		iterator begin() {
+			return values.begin();
+		}
+
+		iterator end() {
+			return values.end();
+		}
+
+		const_iterator cbegin() const {
+			return values.cbegin();
+		}
+
+		const_iterator cend() const {
+			return values.cend();
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_SLOTMAP_H
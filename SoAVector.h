@@ -0,0 +1,438 @@
+#ifndef AISDI_LINEAR_SOAVECTOR_H
+#define AISDI_LINEAR_SOAVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "Span.h"
+
+namespace aisdi {
+
+	// Struct-of-arrays sequence: every field lives in its own contiguous column,
+	// so a scan over one field only touches that field's cache lines.
+	template<typename... Fields>
+	class SoAVector {
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = std::tuple<Fields...>;
+
+		template<size_type Index>
+		using field_type = std::tuple_element_t<Index, value_type>;
+
+		class ConstRow;
+
+		class Row;
+
+		class ConstIterator;
+
+		class Iterator;
+
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+	private:
+		using Indices = std::index_sequence_for<Fields...>;
+
+		std::tuple<Fields *...> columns;
+		size_type capacity;
+		size_type size;
+
+		template<size_type Index>
+		void reallocateColumn(size_type newCapacity) {
+			field_type<Index> *tmp = std::get<Index>(columns);
+			std::get<Index>(columns) = new field_type<Index>[newCapacity];
+			for (size_type i = 0; i < size; i++) {
+				std::get<Index>(columns)[i] = std::move(tmp[i]);
+			}
+			delete[](tmp);
+		}
+
+		template<size_type... Index>
+		void reallocate(size_type newCapacity, std::index_sequence<Index...>) {
+			(reallocateColumn<Index>(newCapacity), ...);
+			capacity = newCapacity;
+		}
+
+		template<size_type... Index>
+		void release(std::index_sequence<Index...>) {
+			(delete[](std::get<Index>(columns)), ...);
+			((std::get<Index>(columns) = nullptr), ...);
+		}
+
+		template<size_type... Index>
+		void store(size_type index, const value_type &row, std::index_sequence<Index...>) {
+			((std::get<Index>(columns)[index] = std::get<Index>(row)), ...);
+		}
+
+		template<size_type... Index>
+		value_type load(size_type index, std::index_sequence<Index...>) const {
+			return value_type(std::get<Index>(columns)[index]...);
+		}
+
+		template<size_type... Index>
+		void move(size_type to, size_type from, std::index_sequence<Index...>) {
+			((std::get<Index>(columns)[to] = std::move(std::get<Index>(columns)[from])), ...);
+		}
+
+		void grow() {
+			reallocate(capacity < 2 ? 2 : capacity * 2, Indices());
+		}
+
+		void copyFrom(const SoAVector &other) {
+			reallocate(other.size, Indices());
+			for (size_type i = 0; i < other.size; i++) {
+				store(i, other.load(i, Indices()), Indices());
+			}
+			size = other.size;
+		}
+
+		size_type indexOf(const const_iterator &position) const {
+			if (position.getOwner() != this || position.getIndex() > size) throw std::out_of_range("position");
+			return position.getIndex();
+		}
+
+	public:
+		SoAVector() : capacity(0), size(0) {}
+
+		SoAVector(std::initializer_list<value_type> l) : capacity(0), size(0) {
+			reallocate(l.size(), Indices());
+			for (auto it = l.begin(); it != l.end(); ++it) {
+				append(*it);
+			}
+		}
+
+		SoAVector(const SoAVector &other) : capacity(0), size(0) {
+			copyFrom(other);
+		}
+
+		SoAVector(SoAVector &&other) noexcept : columns(other.columns), capacity(other.capacity), size(other.size) {
+			other.columns = std::tuple<Fields *...>();
+			other.capacity = 0;
+			other.size = 0;
+		}
+
+		~SoAVector() {
+			release(Indices());
+		}
+
+		SoAVector &operator=(const SoAVector &other) {
+			if (this == &other) return *this;
+			release(Indices());
+			capacity = 0;
+			size = 0;
+			copyFrom(other);
+			return *this;
+		}
+
+		SoAVector &operator=(SoAVector &&other) noexcept {
+			if (this == &other) return *this;
+			release(Indices());
+			columns = other.columns;
+			capacity = other.capacity;
+			size = other.size;
+			other.columns = std::tuple<Fields *...>();
+			other.capacity = 0;
+			other.size = 0;
+			return *this;
+		}
+
+		bool isEmpty() const {
+			return size == 0;
+		}
+
+		size_type getSize() const {
+			return size;
+		}
+
+		void ensureCapacity(size_type requested) {
+			if (requested > capacity) reallocate(requested, Indices());
+		}
+
+		template<size_type Index>
+		Span<field_type<Index>> column() {
+			return Span<field_type<Index>>(std::get<Index>(columns), size);
+		}
+
+		template<size_type Index>
+		Span<const field_type<Index>> column() const {
+			return Span<const field_type<Index>>(std::get<Index>(columns), size);
+		}
+
+		Row operator[](size_type index) {
+			if (index >= size) throw std::out_of_range("op[]");
+			return Row(this, index);
+		}
+
+		ConstRow operator[](size_type index) const {
+			if (index >= size) throw std::out_of_range("op[]");
+			return ConstRow(this, index);
+		}
+
+		void append(const value_type &row) {
+			if (size == capacity) grow();
+			store(size, row, Indices());
+			size++;
+		}
+
+		void append(const Fields &... values) {
+			append(value_type(values...));
+		}
+
+		void prepend(const value_type &row) {
+			insert(cbegin(), row);
+		}
+
+		void prepend(const Fields &... values) {
+			insert(cbegin(), value_type(values...));
+		}
+
+		void insert(const const_iterator &insertPosition, const value_type &row) {
+			size_type index = indexOf(insertPosition);
+			if (size == capacity) grow();
+			for (size_type i = size; i > index; i--) {
+				move(i, i - 1, Indices());
+			}
+			store(index, row, Indices());
+			size++;
+		}
+
+		void insert(const const_iterator &insertPosition, const Fields &... values) {
+			insert(insertPosition, value_type(values...));
+		}
+
+		value_type popFirst() {
+			if (size == 0) throw std::logic_error("popFirst");
+			value_type tmp = load(0, Indices());
+			erase(cbegin());
+			return tmp;
+		}
+
+		value_type popLast() {
+			if (size == 0) throw std::logic_error("popLast");
+			size--;
+			return load(size, Indices());
+		}
+
+		void erase(const const_iterator &position) {
+			size_type index = indexOf(position);
+			if (index == size) throw std::out_of_range("erase");
+			for (size_type i = index + 1; i < size; i++) {
+				move(i - 1, i, Indices());
+			}
+			size--;
+		}
+
+		void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+			size_type first = indexOf(firstIncluded);
+			size_type last = indexOf(lastExcluded);
+			if (first > last) throw std::out_of_range("erase");
+			for (size_type i = last; i < size; i++) {
+				move(first + i - last, i, Indices());
+			}
+			size -= last - first;
+		}
+
+		iterator begin() {
+			return iterator(ConstIterator(this, 0));
+		}
+
+		iterator end() {
+			return iterator(ConstIterator(this, size));
+		}
+
+		const_iterator cbegin() const {
+			return const_iterator(this, 0);
+		}
+
+		const_iterator cend() const {
+			return const_iterator(this, size);
+		}
+
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		const_iterator end() const {
+			return cend();
+		}
+	};
+
+	// Proxy for one row; reads go straight to the owning columns.
+	template<typename... Fields>
+	class SoAVector<Fields...>::ConstRow {
+	protected:
+		const SoAVector *owner;
+		size_type index;
+	public:
+		ConstRow(const SoAVector *owner, size_type index) : owner(owner), index(index) {}
+
+		template<size_type Index>
+		const field_type<Index> &get() const {
+			return std::get<Index>(owner->columns)[index];
+		}
+
+		operator value_type() const {
+			return owner->load(index, Indices());
+		}
+	};
+
+	template<typename... Fields>
+	class SoAVector<Fields...>::Row : public SoAVector<Fields...>::ConstRow {
+	public:
+		Row(SoAVector *owner, size_type index) : ConstRow(owner, index) {}
+
+		template<size_type Index>
+		field_type<Index> &get() const {
+			// ugly cast, yet reduces code duplication.
+			return const_cast<field_type<Index> &>(ConstRow::template get<Index>());
+		}
+
+		const Row &operator=(const value_type &row) const {
+			const_cast<SoAVector *>(this->owner)->store(this->index, row, Indices());
+			return *this;
+		}
+
+		// Assigning rows copies the fields, it never rebinds the proxy.
+		const Row &operator=(const Row &other) const {
+			return *this = static_cast<value_type>(other);
+		}
+
+		Row &operator=(const Row &other) {
+			static_cast<const Row &>(*this) = static_cast<value_type>(other);
+			return *this;
+		}
+	};
+
+	template<typename... Fields>
+	class SoAVector<Fields...>::ConstIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = typename SoAVector::value_type;
+		using difference_type = typename SoAVector::difference_type;
+		using pointer = void;
+		using reference = ConstRow;
+	private:
+		const SoAVector *owner;
+		size_type index;
+	public:
+		explicit ConstIterator() : owner(nullptr), index(0) {}
+
+		ConstIterator(const SoAVector *owner, size_type index) : owner(owner), index(index) {}
+
+		const SoAVector *getOwner() const {
+			return owner;
+		}
+
+		size_type getIndex() const {
+			return index;
+		}
+
+		reference operator*() const {
+			if (index == owner->size) throw std::out_of_range("op*");
+			return ConstRow(owner, index);
+		}
+
+		ConstIterator &operator++() {
+			if (index == owner->size) throw std::out_of_range("++op");
+			index++;
+			return *this;
+		}
+
+		ConstIterator operator++(int) {
+			ConstIterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		ConstIterator &operator--() {
+			if (index == 0) throw std::out_of_range("--op");
+			index--;
+			return *this;
+		}
+
+		ConstIterator operator--(int) {
+			ConstIterator tmp = *this;
+			--(*this);
+			return tmp;
+		}
+
+		ConstIterator operator+(difference_type d) const {
+			ConstIterator tmp = *this;
+			if (static_cast<difference_type>(index) + d > static_cast<difference_type>(owner->size))
+				throw std::out_of_range("op+");
+			tmp.index += d;
+			return tmp;
+		}
+
+		ConstIterator operator-(difference_type d) const {
+			ConstIterator tmp = *this;
+			if (static_cast<difference_type>(index) - d < 0) throw std::out_of_range("op-");
+			tmp.index -= d;
+			return tmp;
+		}
+
+		bool operator==(const ConstIterator &other) const {
+			return owner == other.owner && index == other.index;
+		}
+
+		bool operator!=(const ConstIterator &other) const {
+			return !(*this == other);
+		}
+	};
+
+	template<typename... Fields>
+	class SoAVector<Fields...>::Iterator : public SoAVector<Fields...>::ConstIterator {
+	public:
+		using reference = Row;
+
+		explicit Iterator() {}
+
+		Iterator(const ConstIterator &other)
+				: ConstIterator(other) {}
+
+		Iterator &operator++() {
+			ConstIterator::operator++();
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			auto result = *this;
+			ConstIterator::operator++();
+			return result;
+		}
+
+		Iterator &operator--() {
+			ConstIterator::operator--();
+			return *this;
+		}
+
+		Iterator operator--(int) {
+			auto result = *this;
+			ConstIterator::operator--();
+			return result;
+		}
+
+		Iterator operator+(difference_type d) const {
+			return ConstIterator::operator+(d);
+		}
+
+		Iterator operator-(difference_type d) const {
+			return ConstIterator::operator-(d);
+		}
+
+		reference operator*() const {
+			ConstIterator::operator*();
+			// ugly cast, yet reduces code duplication.
+			return Row(const_cast<SoAVector *>(this->getOwner()), this->getIndex());
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_SOAVECTOR_H
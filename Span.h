@@ -0,0 +1,60 @@
+#ifndef AISDI_LINEAR_SPAN_H
+#define AISDI_LINEAR_SPAN_H
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace aisdi {
+
+	// Non-owning view of a contiguous run of elements.
+	template<typename Type>
+	class Span {
+	public:
+		using size_type = std::size_t;
+		using value_type = Type;
+		using pointer = Type *;
+		using reference = Type &;
+		using iterator = pointer;
+
+	private:
+		pointer first;
+		size_type size;
+
+	public:
+		constexpr Span() : first(nullptr), size(0) {}
+
+		constexpr Span(pointer first, size_type size) : first(first), size(size) {}
+
+		constexpr pointer data() const {
+			return first;
+		}
+
+		constexpr size_type getSize() const {
+			return size;
+		}
+
+		constexpr bool isEmpty() const {
+			return size == 0;
+		}
+
+		constexpr reference operator[](size_type index) const {
+			return first[index];
+		}
+
+		constexpr reference at(size_type index) const {
+			if (index >= size) throw std::out_of_range("at");
+			return first[index];
+		}
+
+		constexpr iterator begin() const {
+			return first;
+		}
+
+		constexpr iterator end() const {
+			return first + size;
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_SPAN_H
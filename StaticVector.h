@@ -0,0 +1,187 @@
+#ifndef AISDI_LINEAR_STATICVECTOR_H
+#define AISDI_LINEAR_STATICVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+	// Vector with inline storage for at most Capacity elements. Never allocates,
+	// so it can be built and modified in constant expressions.
+	template<typename Type, std::size_t Capacity>
+	class StaticVector {
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+		using value_type = Type;
+		using pointer = Type *;
+		using reference = Type &;
+		using const_pointer = const Type *;
+		using const_reference = const Type &;
+
+		using ConstIterator = typename Vector<Type>::ConstIterator;
+		using Iterator = typename Vector<Type>::Iterator;
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+	private:
+		Type storage[Capacity > 0 ? Capacity : 1]{};
+		size_type size = 0;
+
+		constexpr pointer head() {
+			return storage;
+		}
+
+		constexpr const_pointer head() const {
+			return storage;
+		}
+
+		constexpr size_type offsetOf(const const_iterator &position) const {
+			return static_cast<size_type>(position.getPosition() - head());
+		}
+
+	public:
+		constexpr StaticVector() {}
+
+		constexpr StaticVector(std::initializer_list<Type> l) {
+			if (l.size() > Capacity) throw std::length_error("StaticVector");
+			for (auto it = l.begin(); it != l.end(); ++it) {
+				storage[size++] = *it;
+			}
+		}
+
+		constexpr StaticVector(const StaticVector &other) = default;
+
+		constexpr StaticVector &operator=(const StaticVector &other) = default;
+
+		// Moves element by element; the source keeps its size with moved-from values.
+		constexpr StaticVector(StaticVector &&other) = default;
+
+		constexpr StaticVector &operator=(StaticVector &&other) = default;
+
+		static constexpr size_type getCapacity() {
+			return Capacity;
+		}
+
+		constexpr bool isEmpty() const {
+			return size == 0;
+		}
+
+		constexpr size_type getSize() const {
+			return size;
+		}
+
+		constexpr reference operator[](size_type index) {
+			if (index >= size) throw std::out_of_range("op[]");
+			return storage[index];
+		}
+
+		constexpr const_reference operator[](size_type index) const {
+			if (index >= size) throw std::out_of_range("op[]");
+			return storage[index];
+		}
+
+		// The const overloads copy the item first, as shifting may overwrite it.
+		constexpr void append(const Type &item) {
+			append(Type(item));
+		}
+
+		constexpr void append(Type &&item) {
+			if (size == Capacity) throw std::length_error("append");
+			storage[size++] = std::move(item);
+		}
+
+		constexpr void prepend(const Type &item) {
+			prepend(Type(item));
+		}
+
+		constexpr void prepend(Type &&item) {
+			if (size == Capacity) throw std::length_error("prepend");
+			for (size_type i = size; i > 0; i--) {
+				storage[i] = std::move(storage[i - 1]);
+			}
+			storage[0] = std::move(item);
+			size++;
+		}
+
+		constexpr void insert(const const_iterator &insertPosition, const Type &item) {
+			insert(insertPosition, Type(item));
+		}
+
+		constexpr void insert(const const_iterator &insertPosition, Type &&item) {
+			if (size == Capacity) throw std::length_error("insert");
+			size_type index = offsetOf(insertPosition);
+			if (index > size) throw std::out_of_range("insert");
+			for (size_type i = size; i > index; i--) {
+				storage[i] = std::move(storage[i - 1]);
+			}
+			storage[index] = std::move(item);
+			size++;
+		}
+
+		constexpr Type popFirst() {
+			if (size == 0) throw std::logic_error("popFirst");
+			Type tmp = std::move(storage[0]);
+			for (size_type i = 0; i < size - 1; ++i)
+				storage[i] = std::move(storage[i + 1]);
+			size--;
+			return tmp;
+		}
+
+		constexpr Type popLast() {
+			if (size == 0) throw std::logic_error("popLast");
+			return std::move(storage[--size]);
+		}
+
+		constexpr void erase(const const_iterator &position) {
+			size_type index = offsetOf(position);
+			if (index >= size) throw std::out_of_range("erase");
+			for (size_type i = index; i + 1 < size; i++) {
+				storage[i] = std::move(storage[i + 1]);
+			}
+			size--;
+		}
+
+		constexpr void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+			size_type first = offsetOf(firstIncluded);
+			size_type last = offsetOf(lastExcluded);
+			if (first > last || last > size) throw std::out_of_range("erase");
+			for (size_type i = last; i < size; i++) {
+				storage[first + i - last] = std::move(storage[i]);
+			}
+			size -= last - first;
+		}
+
+		constexpr iterator begin() {
+			return iterator(ConstIterator(head(), head() + size, head()));
+		}
+
+		constexpr iterator end() {
+			return iterator(ConstIterator(head(), head() + size, head() + size));
+		}
+
+		constexpr const_iterator cbegin() const {
+			return const_iterator(head(), head() + size, head());
+		}
+
+		constexpr const_iterator cend() const {
+			return const_iterator(head(), head() + size, head() + size);
+		}
+
+		constexpr const_iterator begin() const {
+			return cbegin();
+		}
+
+		constexpr const_iterator end() const {
+			return cend();
+		}
+	};
+
+}
+
+#endif // AISDI_LINEAR_STATICVECTOR_H
@@ -0,0 +1,176 @@
+#ifndef AISDI_LINEAR_STORAGE_H
+#define AISDI_LINEAR_STORAGE_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace aisdi {
+
+	// Storage policies decide where Vector's buffer comes from. Each one hands
+	// out `count` default-constructed elements and takes them back with the
+	// same count.
+
+	struct HeapStorage {
+		template<typename Type>
+		static Type *allocate(std::size_t count) {
+			return new Type[count];
+		}
+
+		template<typename Type>
+		static void deallocate(Type *block, std::size_t) {
+			delete[](block);
+		}
+	};
+
+	namespace detail {
+		template<typename Type>
+		void constructElements(Type *block, std::size_t count) {
+			std::size_t i = 0;
+			try {
+				for (; i < count; i++) new(block + i) Type;
+			} catch (...) {
+				while (i > 0) block[--i].~Type();
+				throw;
+			}
+		}
+
+		template<typename Type>
+		void destroyElements(Type *block, std::size_t count) {
+			if (std::is_trivially_destructible<Type>::value) return;
+			for (std::size_t i = 0; i < count; i++) block[i].~Type();
+		}
+	}
+
+	// Buffer aligned to Alignment bytes, e.g. 64 for a cache line.
+	template<std::size_t Alignment>
+	struct AlignedStorage {
+		static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+		template<typename Type>
+		static Type *allocate(std::size_t count) {
+			constexpr std::size_t alignment = Alignment < alignof(Type) ? alignof(Type) : Alignment;
+			Type *block = static_cast<Type *>(::operator new(count * sizeof(Type), std::align_val_t(alignment)));
+			try {
+				detail::constructElements(block, count);
+			} catch (...) {
+				::operator delete(block, std::align_val_t(alignment));
+				throw;
+			}
+			return block;
+		}
+
+		template<typename Type>
+		static void deallocate(Type *block, std::size_t count) {
+			constexpr std::size_t alignment = Alignment < alignof(Type) ? alignof(Type) : Alignment;
+			detail::destroyElements(block, count);
+			::operator delete(block, std::align_val_t(alignment));
+		}
+	};
+
+	// Buffers of at least one huge page are mapped directly, aligned to the huge
+	// page size and advised with MADV_HUGEPAGE so the kernel backs them with
+	// transparent huge pages. Smaller buffers fall back to AlignedStorage.
+	//
+	// With ParallelFirstTouch, trivially constructible elements are zeroed by one
+	// thread per hardware core, each over its own contiguous slice, so that on a
+	// NUMA machine every slice lands on the node of the thread that first wrote
+	// it. Otherwise pages are placed on the node of whoever first writes them.
+	template<std::size_t Alignment = 64, bool ParallelFirstTouch = false>
+	struct LargePageStorage {
+		static constexpr std::size_t hugePageSize = std::size_t(2) << 20;
+
+		template<typename Type>
+		static Type *allocate(std::size_t count) {
+			std::size_t bytes = count * sizeof(Type);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+			if (bytes >= hugePageSize) {
+				std::size_t length = roundUp(bytes);
+				Type *block = static_cast<Type *>(mapAligned(length));
+				madvise(block, length, MADV_HUGEPAGE);
+				try {
+					if (ParallelFirstTouch && std::is_trivially_default_constructible<Type>::value)
+						touchInParallel(block, bytes);
+					else
+						detail::constructElements(block, count);
+				} catch (...) {
+					munmap(block, length);
+					throw;
+				}
+				return block;
+			}
+#endif
+			(void) bytes;
+			return AlignedStorage<Alignment>::template allocate<Type>(count);
+		}
+
+		template<typename Type>
+		static void deallocate(Type *block, std::size_t count) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+			std::size_t bytes = count * sizeof(Type);
+			if (bytes >= hugePageSize) {
+				detail::destroyElements(block, count);
+				munmap(block, roundUp(bytes));
+				return;
+			}
+#endif
+			AlignedStorage<Alignment>::template deallocate<Type>(block, count);
+		}
+
+	private:
+		static std::size_t roundUp(std::size_t bytes) {
+			return (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+		}
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+		// mmap only guarantees page alignment, so map one huge page extra and
+		// trim both ends down to a huge page boundary.
+		static void *mapAligned(std::size_t length) {
+			std::size_t padded = length + hugePageSize;
+			void *raw = mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (raw == MAP_FAILED) throw std::bad_alloc();
+			char *begin = static_cast<char *>(raw);
+			char *aligned = reinterpret_cast<char *>(roundUp(reinterpret_cast<std::size_t>(begin)));
+			if (aligned != begin) munmap(begin, aligned - begin);
+			std::size_t trailing = (begin + padded) - (aligned + length);
+			if (trailing != 0) munmap(aligned + length, trailing);
+			return aligned;
+		}
+
+		static void touchInParallel(void *block, std::size_t bytes) {
+			std::size_t threadCount = std::thread::hardware_concurrency();
+			if (threadCount < 2) {
+				std::memset(block, 0, bytes);
+				return;
+			}
+			std::size_t slice = roundUp((bytes + threadCount - 1) / threadCount);
+			std::thread *threads = new std::thread[threadCount];
+			std::size_t started = 0;
+			try {
+				for (std::size_t offset = 0; offset < bytes; offset += slice) {
+					std::size_t length = bytes - offset < slice ? bytes - offset : slice;
+					threads[started] = std::thread([block, offset, length]() {
+						std::memset(static_cast<char *>(block) + offset, 0, length);
+					});
+					started++;
+				}
+			} catch (...) {
+				for (std::size_t i = 0; i < started; i++) threads[i].join();
+				delete[](threads);
+				throw;
+			}
+			for (std::size_t i = 0; i < started; i++) threads[i].join();
+			delete[](threads);
+		}
+#endif
+	};
+
+}
+
+#endif // AISDI_LINEAR_STORAGE_H
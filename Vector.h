@@ -5,10 +5,13 @@
 #include <initializer_list>
 #include <stdexcept>
 #include <cstring>
+#include <utility>
+
+#include "Storage.h"
 
 namespace aisdi {
 
-	template<typename Type>
+	template<typename Type, typename Storage = HeapStorage>
 	class Vector {
 
 	public:
@@ -25,25 +28,35 @@ namespace aisdi {
 		size_type capacity;
 		size_type size;
 
+		// One spare slot past capacity, as erase and insert may touch it.
+		static pointer allocate(size_type count) {
+			return Storage::template allocate<Type>(count + 1);
+		}
+
+		static void deallocate(pointer block, size_type count) {
+			if (block != nullptr) Storage::template deallocate<Type>(block, count + 1);
+		}
+
 		void reserve(size_type allocSize) {
-			head = new Type[allocSize + 1];
+			head = allocate(allocSize);
 			tail = head;
 			capacity = allocSize;
 			size = 0;
 		}
 
+		size_type grownCapacity() const {
+			return capacity < 2 ? 2 : ((capacity - 1) * 2) + 1;
+		}
+
 		void reReserve() {
-			if (capacity == 0) {
-				reserve(2);
-				return;
-			}
 			pointer tmp = head;
-			capacity = ((capacity - 1) * 2) + 1;
-			head = new Type[capacity];
+			size_type oldCapacity = capacity;
+			capacity = grownCapacity();
+			head = allocate(capacity);
 			for (size_type i = 0; i < size; i++) {
-				*(head + i) = *(tmp + i);
+				*(head + i) = std::move(*(tmp + i));
 			}
-			delete[](tmp);
+			deallocate(tmp, oldCapacity);
 			tail = head + size;
 		}
 
@@ -78,7 +91,7 @@ namespace aisdi {
 			tail = head + size;
 		}
 
-		Vector(Vector &&other) : head(other.head), tail(other.tail), capacity(other.capacity), size(other.size) {
+		Vector(Vector &&other) noexcept : head(other.head), tail(other.tail), capacity(other.capacity), size(other.size) {
 			other.head = nullptr;
 			other.tail = nullptr;
 			other.size = 0;
@@ -86,12 +99,12 @@ namespace aisdi {
 		}
 
 		~Vector() {
-			delete[](head);
+			deallocate(head, capacity);
 		}
 
 		Vector &operator=(const Vector &other) {
 			if (this == &other) return *this;
-			delete[](head);
+			deallocate(head, capacity);
 			reserve(other.getSize());
 			for (auto it = other.begin(); it != other.end(); ++it) {
 				append(*it);
@@ -101,9 +114,9 @@ namespace aisdi {
 			return *this;
 		}
 
-		Vector &operator=(Vector &&other) {
+		Vector &operator=(Vector &&other) noexcept {
 			if (this == &other) return *this;
-			delete[](head);
+			deallocate(head, capacity);
 			head = other.head;
 			tail = other.tail;
 			capacity = other.capacity;
@@ -123,61 +136,98 @@ namespace aisdi {
 			return size;
 		}
 
+		pointer data() {
+			return head;
+		}
+
+		const_pointer data() const {
+			return head;
+		}
+
+		void ensureCapacity(size_type requested) {
+			if (requested <= capacity) return;
+			pointer tmp = head;
+			head = allocate(requested);
+			for (size_type i = 0; i < size; i++) {
+				*(head + i) = std::move(*(tmp + i));
+			}
+			deallocate(tmp, capacity);
+			capacity = requested;
+			tail = head + size;
+		}
+
+		// The const overloads copy the item before the buffer may be reallocated,
+		// so appending an element of this vector to itself is safe.
 		void append(const Type &item) {
+			append(Type(item));
+		}
+
+		void append(Type &&item) {
 			if (size == capacity) reReserve();
-			*(tail) = item;
+			*(tail) = std::move(item);
 			size++;
 			tail++;
 		}
 
 		void prepend(const Type &item) {
+			prepend(Type(item));
+		}
+
+		void prepend(Type &&item) {
 			if (size == capacity) {
 				pointer tmp = head;
-				capacity = ((capacity - 1) * 2) + 1;
-				head = new Type[capacity];
-				*head = item;
+				size_type oldCapacity = capacity;
+				capacity = grownCapacity();
+				head = allocate(capacity);
+				*head = std::move(item);
 				for (size_type i = 1; i <= size; i++) {
-					*(head + i) = *(tmp + i - 1);
+					*(head + i) = std::move(*(tmp + i - 1));
 				}
-				delete[](tmp);
+				deallocate(tmp, oldCapacity);
 				size++;
 				tail = head + size;
 			} else {
 				for (size_type i = size; i > 0; i--) {
-					*(head + i) = *(head + i - 1);
+					*(head + i) = std::move(*(head + i - 1));
 				}
-				*head = item;
+				*head = std::move(item);
 				size++;
 				tail++;
 			}
 		}
 
 		void insert(const const_iterator &insertPosition, const Type &item) {
+			insert(insertPosition, Type(item));
+		}
+
+		void insert(const const_iterator &insertPosition, Type &&item) {
 			if (size == capacity) {
 				pointer tmp = head;
-				capacity = ((capacity - 1) * 2) + 1;
-				head = new Type[capacity]; //extend vector
+				size_type oldCapacity = capacity;
+				capacity = grownCapacity();
+				head = allocate(capacity); //extend vector
 				int offset = 0;
 				for (size_type i = 0; i <=
-															size; ++i) //copy old vector into new, if position == insert position put item and adjust copying other elements
+															size; ++i) //move old vector into new, if position == insert position put item and adjust moving other elements
 				{
 					if (tmp + i == insertPosition.getPosition()) {
-						*(head + i) = item;
+						*(head + i) = std::move(item);
 						offset = 1;
 					} else {
-						*(head + i) = *(tmp + i - offset);
+						*(head + i) = std::move(*(tmp + i - offset));
 					}
 				}
+				deallocate(tmp, oldCapacity);
 				size++;
 				tail = head + size;
 			} else //shift elements until item
 			{
 				for (size_type i = size;; --i) {
 					if (head + i == insertPosition.getPosition()) {
-						*(head + i) = item;
+						*(head + i) = std::move(item);
 						break;
 					} else {
-						*(head + i) = *(head + i - 1);
+						*(head + i) = std::move(*(head + i - 1));
 					}
 					if (i == 0) break;
 				}
@@ -188,9 +238,9 @@ namespace aisdi {
 
 		Type popFirst() {
 			if (size == 0) throw std::logic_error("popFirst");
-			Type tmp = *head;
+			Type tmp = std::move(*head);
 			for (size_type i = 0; i < size - 1; ++i)
-				*(head + i) = *(head + i + 1);
+				*(head + i) = std::move(*(head + i + 1));
 			size--;
 			tail--;
 			return tmp;
@@ -199,16 +249,15 @@ namespace aisdi {
 		Type popLast() {
 			if (size == 0) throw std::logic_error("popLast");
 			size--;
-			Type tmp = *(--tail);
-			return tmp;
+			return std::move(*(--tail));
 		}
 
 		void erase(const const_iterator &position) {
 			if (isEmpty()) throw std::out_of_range("erase");
 			if (position.getPosition() == tail) throw std::out_of_range("erase");
 			pointer tmp = head + (position.getPosition() - head);///!!!!!!!!!!!!
-			while (tmp != tail) {
-				*tmp = *(tmp + 1);
+			while (tmp + 1 != tail) {
+				*tmp = std::move(*(tmp + 1));
 				tmp++;
 			}
 
@@ -218,17 +267,53 @@ namespace aisdi {
 
 		void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
 			pointer tmp = head + (firstIncluded.getPosition() - head); ///!!!!!!!!!!!!!!!!
-			auto tmpIt = lastExcluded;
+			pointer source = head + (lastExcluded.getPosition() - head);
 			size = size - (lastExcluded.getPosition() - firstIncluded.getPosition());
 			tail = tail - (lastExcluded.getPosition() - firstIncluded.getPosition());
 			while (tmp != tail) {
-				*tmp = *tmpIt;
-				tmpIt++;
+				*tmp = std::move(*source);
+				source++;
 				tmp++;
 			}
 
 		}
 
+		// Compacts the survivors towards the front in a single pass and truncates
+		// the tail once, instead of shifting the tail for every removed element.
+		template<typename Predicate>
+		size_type eraseIf(Predicate predicate) {
+			pointer write = head;
+			for (pointer read = head; read != tail; ++read) {
+				if (predicate(*read)) continue;
+				if (write != read) *write = std::move(*read);
+				++write;
+			}
+			size_type removed = tail - write;
+			size -= removed;
+			tail = write;
+			return removed;
+		}
+
+		size_type removeValue(const Type &value) {
+			const Type copy = value; // value may alias an element that gets overwritten
+			return eraseIf([&copy](const Type &item) { return item == copy; });
+		}
+
+		size_type unique() {
+			if (size < 2) return 0;
+			pointer write = head;
+			for (pointer read = head + 1; read != tail; ++read) {
+				if (*read == *write) continue;
+				++write;
+				if (write != read) *write = std::move(*read);
+			}
+			++write;
+			size_type removed = tail - write;
+			size -= removed;
+			tail = write;
+			return removed;
+		}
+
 		iterator begin() {
 			return iterator(ConstIterator(head, tail, head));
 		}
@@ -254,8 +339,8 @@ namespace aisdi {
 		}
 	};
 
-	template<typename Type>
-	class Vector<Type>::ConstIterator {
+	template<typename Type, typename Storage>
+	class Vector<Type, Storage>::ConstIterator {
 	public:
 		using iterator_category = std::bidirectional_iterator_tag;
 		using value_type = typename Vector::value_type;
@@ -267,108 +352,108 @@ namespace aisdi {
 		pointer end;
 		pointer position;
 	public:
-		explicit ConstIterator() {}
+		constexpr explicit ConstIterator() : begin(nullptr), end(nullptr), position(nullptr) {}
 
-		ConstIterator(pointer begin, pointer end, pointer position) : begin(begin), end(end), position(position) {}
+		constexpr ConstIterator(pointer begin, pointer end, pointer position) : begin(begin), end(end), position(position) {}
 
-		pointer getPosition() const {
+		constexpr pointer getPosition() const {
 			return position;
 		}
 
-		reference operator*() const {
+		constexpr reference operator*() const {
 			if (position == end) throw std::out_of_range("op*");
 			return *position;
 		}
 
-		ConstIterator &operator++() {
+		constexpr ConstIterator &operator++() {
 			if (position == end) throw std::out_of_range("++op");
 			position++;
 			return *this;
 		}
 
-		ConstIterator operator++(int) {
+		constexpr ConstIterator operator++(int) {
 			ConstIterator tmp = *this;
 			++(*this);
 			return tmp;
 		}
 
-		ConstIterator &operator--() {
+		constexpr ConstIterator &operator--() {
 			if (position == begin) throw std::out_of_range("--op");
 			position--;
 			return *this;
 		}
 
-		ConstIterator operator--(int) {
+		constexpr ConstIterator operator--(int) {
 			ConstIterator tmp = *this;
 			--(*this);
 			return tmp;
 		}
 
-		ConstIterator operator+(difference_type d) const {
+		constexpr ConstIterator operator+(difference_type d) const {
 			ConstIterator tmp = *this;
 			if (position + d > end) throw std::out_of_range("op--");
 			tmp.position += d;
 			return tmp;
 		}
 
-		ConstIterator operator-(difference_type d) const {
+		constexpr ConstIterator operator-(difference_type d) const {
 			ConstIterator tmp = *this;
 			if (position - d < begin) throw std::out_of_range("op--");
 			tmp.position -= d;
 			return tmp;
 		}
 
-		bool operator==(const ConstIterator &other) const {
+		constexpr bool operator==(const ConstIterator &other) const {
 			return (position == other.position);
 		}
 
-		bool operator!=(const ConstIterator &other) const {
+		constexpr bool operator!=(const ConstIterator &other) const {
 			return (position != other.position);
 		}
 	};
 
-	template<typename Type>
-	class Vector<Type>::Iterator : public Vector<Type>::ConstIterator {
+	template<typename Type, typename Storage>
+	class Vector<Type, Storage>::Iterator : public Vector<Type, Storage>::ConstIterator {
 	public:
 		using pointer = typename Vector::pointer;
 		using reference = typename Vector::reference;
 
-		explicit Iterator() {}
+		constexpr explicit Iterator() {}
 
-		Iterator(const ConstIterator &other)
+		constexpr Iterator(const ConstIterator &other)
 				: ConstIterator(other) {}
 
-		Iterator &operator++() {
+		constexpr Iterator &operator++() {
 			ConstIterator::operator++();
 			return *this;
 		}
 
-		Iterator operator++(int) {
+		constexpr Iterator operator++(int) {
 			auto result = *this;
 			ConstIterator::operator++();
 			return result;
 		}
 
-		Iterator &operator--() {
+		constexpr Iterator &operator--() {
 			ConstIterator::operator--();
 			return *this;
 		}
 
-		Iterator operator--(int) {
+		constexpr Iterator operator--(int) {
 			auto result = *this;
 			ConstIterator::operator--();
 			return result;
 		}
 
-		Iterator operator+(difference_type d) const {
+		constexpr Iterator operator+(difference_type d) const {
 			return ConstIterator::operator+(d);
 		}
 
-		Iterator operator-(difference_type d) const {
+		constexpr Iterator operator-(difference_type d) const {
 			return ConstIterator::operator-(d);
 		}
 
-		reference operator*() const {
+		constexpr reference operator*() const {
 			// ugly cast, yet reduces code duplication.
 			return const_cast<reference>(ConstIterator::operator*());
 		}
@@ -0,0 +1,639 @@
+#ifndef AISDI_LINEAR_VIEWS_H
+#define AISDI_LINEAR_VIEWS_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi {
+namespace views {
+
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+
+	namespace detail {
+		template<typename Container>
+		void reserveFor(Container &, size_type) {}
+
+		template<typename Type, typename Storage>
+		void reserveFor(Vector<Type, Storage> &container, size_type count) {
+			container.ensureCapacity(count);
+		}
+	}
+
+	// Common base of every view. A view is a lazy pair of iterators; nothing is
+	// evaluated until it is iterated or collected, so a whole chain runs in one pass.
+	template<typename Derived>
+	class View {
+	public:
+		template<template<typename...> class Container>
+		auto collect() const {
+			const Derived &self = static_cast<const Derived &>(*this);
+			Container<typename Derived::value_type> result;
+			if constexpr (Derived::isSized) detail::reserveFor(result, self.getSize());
+			for (auto it = self.begin(); it != self.end(); ++it) {
+				result.append(*it);
+			}
+			return result;
+		}
+	};
+
+	template<typename Source>
+	using IsView = std::is_base_of<View<std::decay_t<Source>>, std::decay_t<Source>>;
+
+	template<typename Container>
+	class RefView : public View<RefView<Container>> {
+	private:
+		const Container *container;
+	public:
+		using value_type = typename Container::value_type;
+		using iterator = typename Container::const_iterator;
+		static constexpr bool isSized = true;
+
+		RefView() : container(nullptr) {}
+
+		explicit RefView(const Container &container) : container(&container) {}
+
+		iterator begin() const {
+			return container->begin();
+		}
+
+		iterator end() const {
+			return container->end();
+		}
+
+		size_type getSize() const {
+			return container->getSize();
+		}
+	};
+
+	template<typename Container>
+	class OwningView : public View<OwningView<Container>> {
+	private:
+		Container container;
+	public:
+		using value_type = typename Container::value_type;
+		using iterator = typename Container::const_iterator;
+		static constexpr bool isSized = true;
+
+		explicit OwningView(Container &&container) : container(std::move(container)) {}
+
+		iterator begin() const {
+			return container.begin();
+		}
+
+		iterator end() const {
+			return container.end();
+		}
+
+		size_type getSize() const {
+			return container.getSize();
+		}
+	};
+
+	template<typename Iter>
+	class Subrange : public View<Subrange<Iter>> {
+	private:
+		Iter first;
+		Iter last;
+		size_type size;
+	public:
+		using value_type = typename std::iterator_traits<Iter>::value_type;
+		using iterator = Iter;
+		static constexpr bool isSized = true;
+
+		Subrange() : size(0) {}
+
+		Subrange(Iter first, Iter last, size_type size) : first(first), last(last), size(size) {}
+
+		iterator begin() const {
+			return first;
+		}
+
+		iterator end() const {
+			return last;
+		}
+
+		size_type getSize() const {
+			return size;
+		}
+	};
+
+	template<typename Source>
+	auto all(Source &&source) {
+		using Decayed = std::decay_t<Source>;
+		if constexpr (IsView<Source>::value)
+			return Decayed(std::forward<Source>(source));
+		else if constexpr (std::is_lvalue_reference<Source>::value)
+			return RefView<Decayed>(source);
+		else
+			return OwningView<Decayed>(std::move(source));
+	}
+
+	template<typename Base, typename Predicate>
+	class FilterView : public View<FilterView<Base, Predicate>> {
+	private:
+		Base base;
+		Predicate predicate;
+	public:
+		using value_type = typename Base::value_type;
+		static constexpr bool isSized = false;
+
+		class Iterator {
+		private:
+			using BaseIterator = typename Base::iterator;
+			BaseIterator current;
+			BaseIterator last;
+			const Predicate *predicate;
+
+			void skip() {
+				while (current != last && !(*predicate)(*current)) ++current;
+			}
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = typename FilterView::value_type;
+			using difference_type = views::difference_type;
+			using pointer = const value_type *;
+			using reference = decltype(*std::declval<BaseIterator>());
+
+			Iterator() : predicate(nullptr) {}
+
+			Iterator(BaseIterator current, BaseIterator last, const Predicate *predicate)
+					: current(current), last(last), predicate(predicate) {
+				skip();
+			}
+
+			reference operator*() const {
+				return *current;
+			}
+
+			Iterator &operator++() {
+				++current;
+				skip();
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator &other) const {
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator &other) const {
+				return current != other.current;
+			}
+		};
+
+		using iterator = Iterator;
+
+		FilterView(Base base, Predicate predicate) : base(std::move(base)), predicate(std::move(predicate)) {}
+
+		iterator begin() const {
+			return iterator(base.begin(), base.end(), &predicate);
+		}
+
+		iterator end() const {
+			return iterator(base.end(), base.end(), &predicate);
+		}
+	};
+
+	template<typename Base, typename Function>
+	class MapView : public View<MapView<Base, Function>> {
+	private:
+		Base base;
+		Function function;
+	public:
+		using value_type = std::decay_t<std::invoke_result_t<const Function &, const typename Base::value_type &>>;
+		static constexpr bool isSized = Base::isSized;
+
+		class Iterator {
+		private:
+			using BaseIterator = typename Base::iterator;
+			BaseIterator current;
+			const Function *function;
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = typename MapView::value_type;
+			using difference_type = views::difference_type;
+			using pointer = const value_type *;
+			using reference = value_type;
+
+			Iterator() : function(nullptr) {}
+
+			Iterator(BaseIterator current, const Function *function) : current(current), function(function) {}
+
+			reference operator*() const {
+				return (*function)(*current);
+			}
+
+			Iterator &operator++() {
+				++current;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator &other) const {
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator &other) const {
+				return current != other.current;
+			}
+		};
+
+		using iterator = Iterator;
+
+		MapView(Base base, Function function) : base(std::move(base)), function(std::move(function)) {}
+
+		iterator begin() const {
+			return iterator(base.begin(), &function);
+		}
+
+		iterator end() const {
+			return iterator(base.end(), &function);
+		}
+
+		size_type getSize() const {
+			return base.getSize();
+		}
+	};
+
+	template<typename Base>
+	class TakeView : public View<TakeView<Base>> {
+	private:
+		Base base;
+		size_type count;
+	public:
+		using value_type = typename Base::value_type;
+		static constexpr bool isSized = Base::isSized;
+
+		class Iterator {
+		private:
+			using BaseIterator = typename Base::iterator;
+			BaseIterator current;
+			BaseIterator last;
+			size_type remaining;
+
+			bool isDone() const {
+				return remaining == 0 || current == last;
+			}
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = typename TakeView::value_type;
+			using difference_type = views::difference_type;
+			using pointer = const value_type *;
+			using reference = decltype(*std::declval<BaseIterator>());
+
+			Iterator() : remaining(0) {}
+
+			Iterator(BaseIterator current, BaseIterator last, size_type remaining)
+					: current(current), last(last), remaining(remaining) {}
+
+			reference operator*() const {
+				return *current;
+			}
+
+			// The base is not advanced past the last taken element, so a filter
+			// below us never scans ahead for a match nobody asked for.
+			Iterator &operator++() {
+				if (--remaining > 0) ++current;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator &other) const {
+				if (isDone() || other.isDone()) return isDone() == other.isDone();
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator &other) const {
+				return !(*this == other);
+			}
+		};
+
+		using iterator = Iterator;
+
+		TakeView(Base base, size_type count) : base(std::move(base)), count(count) {}
+
+		iterator begin() const {
+			return iterator(base.begin(), base.end(), count);
+		}
+
+		iterator end() const {
+			return iterator(base.end(), base.end(), 0);
+		}
+
+		size_type getSize() const {
+			return base.getSize() < count ? base.getSize() : count;
+		}
+	};
+
+	template<typename Base>
+	class DropView : public View<DropView<Base>> {
+	private:
+		Base base;
+		size_type count;
+	public:
+		using value_type = typename Base::value_type;
+		using iterator = typename Base::iterator;
+		static constexpr bool isSized = Base::isSized;
+
+		DropView(Base base, size_type count) : base(std::move(base)), count(count) {}
+
+		iterator begin() const {
+			auto it = base.begin();
+			auto last = base.end();
+			for (size_type i = 0; i < count && it != last; ++i) ++it;
+			return it;
+		}
+
+		iterator end() const {
+			return base.end();
+		}
+
+		size_type getSize() const {
+			return base.getSize() > count ? base.getSize() - count : 0;
+		}
+	};
+
+	template<typename Base>
+	class ChunkView : public View<ChunkView<Base>> {
+	private:
+		using BaseIterator = typename Base::iterator;
+		Base base;
+		size_type chunkSize;
+	public:
+		using value_type = Subrange<BaseIterator>;
+		static constexpr bool isSized = Base::isSized;
+
+		class Iterator {
+		private:
+			BaseIterator current;
+			BaseIterator next;
+			BaseIterator last;
+			size_type chunkSize;
+			size_type length;
+
+			void measure() {
+				next = current;
+				length = 0;
+				while (length < chunkSize && next != last) {
+					++next;
+					++length;
+				}
+			}
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = typename ChunkView::value_type;
+			using difference_type = views::difference_type;
+			using pointer = const value_type *;
+			using reference = value_type;
+
+			Iterator() : chunkSize(0), length(0) {}
+
+			Iterator(BaseIterator current, BaseIterator last, size_type chunkSize)
+					: current(current), last(last), chunkSize(chunkSize) {
+				measure();
+			}
+
+			reference operator*() const {
+				return value_type(current, next, length);
+			}
+
+			Iterator &operator++() {
+				current = next;
+				measure();
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator &other) const {
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator &other) const {
+				return current != other.current;
+			}
+		};
+
+		using iterator = Iterator;
+
+		ChunkView(Base base, size_type chunkSize) : base(std::move(base)), chunkSize(chunkSize) {
+			if (chunkSize == 0) throw std::invalid_argument("chunk");
+		}
+
+		iterator begin() const {
+			return iterator(base.begin(), base.end(), chunkSize);
+		}
+
+		iterator end() const {
+			return iterator(base.end(), base.end(), chunkSize);
+		}
+
+		size_type getSize() const {
+			return (base.getSize() + chunkSize - 1) / chunkSize;
+		}
+	};
+
+	template<typename Left, typename Right>
+	class ZipView : public View<ZipView<Left, Right>> {
+	private:
+		Left left;
+		Right right;
+	public:
+		using value_type = std::pair<typename Left::value_type, typename Right::value_type>;
+		static constexpr bool isSized = Left::isSized && Right::isSized;
+
+		class Iterator {
+		private:
+			using LeftIterator = typename Left::iterator;
+			using RightIterator = typename Right::iterator;
+			LeftIterator leftCurrent;
+			LeftIterator leftLast;
+			RightIterator rightCurrent;
+			RightIterator rightLast;
+
+			bool isDone() const {
+				return leftCurrent == leftLast || rightCurrent == rightLast;
+			}
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = typename ZipView::value_type;
+			using difference_type = views::difference_type;
+			using pointer = const value_type *;
+			using reference = value_type;
+
+			Iterator() {}
+
+			Iterator(LeftIterator leftCurrent, LeftIterator leftLast, RightIterator rightCurrent, RightIterator rightLast)
+					: leftCurrent(leftCurrent), leftLast(leftLast), rightCurrent(rightCurrent), rightLast(rightLast) {}
+
+			reference operator*() const {
+				return value_type(*leftCurrent, *rightCurrent);
+			}
+
+			Iterator &operator++() {
+				++leftCurrent;
+				++rightCurrent;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator &other) const {
+				if (isDone() || other.isDone()) return isDone() == other.isDone();
+				return leftCurrent == other.leftCurrent && rightCurrent == other.rightCurrent;
+			}
+
+			bool operator!=(const Iterator &other) const {
+				return !(*this == other);
+			}
+		};
+
+		using iterator = Iterator;
+
+		ZipView(Left left, Right right) : left(std::move(left)), right(std::move(right)) {}
+
+		iterator begin() const {
+			return iterator(left.begin(), left.end(), right.begin(), right.end());
+		}
+
+		iterator end() const {
+			return iterator(left.end(), left.end(), right.end(), right.end());
+		}
+
+		size_type getSize() const {
+			return left.getSize() < right.getSize() ? left.getSize() : right.getSize();
+		}
+	};
+
+	// Adaptor closures, applied with operator|: `list | views::filter(p) | views::take(10)`.
+	template<typename Derived>
+	class Adaptor {
+	};
+
+	template<typename Source, typename Derived>
+	auto operator|(Source &&source, const Adaptor<Derived> &adaptor) {
+		return static_cast<const Derived &>(adaptor)(all(std::forward<Source>(source)));
+	}
+
+	template<typename Predicate>
+	class FilterAdaptor : public Adaptor<FilterAdaptor<Predicate>> {
+	private:
+		Predicate predicate;
+	public:
+		explicit FilterAdaptor(Predicate predicate) : predicate(std::move(predicate)) {}
+
+		template<typename Base>
+		FilterView<Base, Predicate> operator()(Base base) const {
+			return FilterView<Base, Predicate>(std::move(base), predicate);
+		}
+	};
+
+	template<typename Function>
+	class MapAdaptor : public Adaptor<MapAdaptor<Function>> {
+	private:
+		Function function;
+	public:
+		explicit MapAdaptor(Function function) : function(std::move(function)) {}
+
+		template<typename Base>
+		MapView<Base, Function> operator()(Base base) const {
+			return MapView<Base, Function>(std::move(base), function);
+		}
+	};
+
+	template<template<typename> class ViewType>
+	class CountAdaptor : public Adaptor<CountAdaptor<ViewType>> {
+	private:
+		size_type count;
+	public:
+		explicit CountAdaptor(size_type count) : count(count) {}
+
+		template<typename Base>
+		ViewType<Base> operator()(Base base) const {
+			return ViewType<Base>(std::move(base), count);
+		}
+	};
+
+	template<typename Right>
+	class ZipAdaptor : public Adaptor<ZipAdaptor<Right>> {
+	private:
+		Right right;
+	public:
+		explicit ZipAdaptor(Right right) : right(std::move(right)) {}
+
+		template<typename Left>
+		ZipView<Left, Right> operator()(Left left) const {
+			return ZipView<Left, Right>(std::move(left), right);
+		}
+	};
+
+	template<typename Predicate>
+	FilterAdaptor<Predicate> filter(Predicate predicate) {
+		return FilterAdaptor<Predicate>(std::move(predicate));
+	}
+
+	template<typename Function>
+	MapAdaptor<Function> map(Function function) {
+		return MapAdaptor<Function>(std::move(function));
+	}
+
+	inline CountAdaptor<TakeView> take(size_type count) {
+		return CountAdaptor<TakeView>(count);
+	}
+
+	inline CountAdaptor<DropView> drop(size_type count) {
+		return CountAdaptor<DropView>(count);
+	}
+
+	inline CountAdaptor<ChunkView> chunk(size_type chunkSize) {
+		return CountAdaptor<ChunkView>(chunkSize);
+	}
+
+	template<typename Right>
+	auto zip(Right &&right) {
+		auto rightView = all(std::forward<Right>(right));
+		return ZipAdaptor<decltype(rightView)>(std::move(rightView));
+	}
+
+	template<typename Left, typename Right>
+	auto zip(Left &&left, Right &&right) {
+		return std::forward<Left>(left) | zip(std::forward<Right>(right));
+	}
+
+}
+}
+
+#endif // AISDI_LINEAR_VIEWS_H
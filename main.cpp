@@ -6,6 +6,15 @@
 #include<chrono>
 #include<iostream>
 #include "LinkedList.h"
+#include "FlatSet.h"
+#include "GapBuffer.h"
+#include "ConcurrentLinkedList.h"
+#include <atomic>
+#include <shared_mutex>
+#include <thread>
+#include <random>
+#include <algorithm>
+#include <cstdint>
 
 /*namespace
 {
@@ -30,6 +39,122 @@ int main(int argc, char** argv)
 }*/
 using namespace aisdi;
 
+/***************************************
+ * sequential and random scan over a large vector
+****************************************/
+template<typename Storage>
+void largeScanTest(const char *name, std::size_t bytes, std::size_t randomReads)
+{
+	const std::size_t count = bytes / sizeof(std::uint64_t);
+	auto startFill = std::chrono::steady_clock::now();
+	Vector<std::uint64_t, Storage> vector;
+	vector.ensureCapacity(count);
+	for(std::size_t j = 0; j < count; j++)
+	{
+		vector.append(j);
+	}
+	auto endFill = std::chrono::steady_clock::now();
+	const std::uint64_t *data = vector.data();
+	std::uint64_t sum = 0;
+	auto startSequential = std::chrono::steady_clock::now();
+	for(std::size_t j = 0; j < count; j++)
+	{
+		sum += data[j];
+	}
+	auto endSequential = std::chrono::steady_clock::now();
+	std::uint64_t state = 88172645463325252ull;
+	auto startRandom = std::chrono::steady_clock::now();
+	for(std::size_t j = 0; j < randomReads; j++)
+	{
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		sum += data[(state >> 16) % count];
+	}
+	auto endRandom = std::chrono::steady_clock::now();
+	std::cout<<name<<" fill "<<count<<" elements time: "<< std::chrono::duration_cast<std::chrono::microseconds>(endFill-startFill).count()<<"\n";
+	std::cout<<name<<" sequential scan time: "<< std::chrono::duration_cast<std::chrono::microseconds>(endSequential-startSequential).count()<<"\n";
+	std::cout<<name<<" random "<<randomReads<<" reads time: "<< std::chrono::duration_cast<std::chrono::microseconds>(endRandom-startRandom).count()<<" (checksum "<<sum<<")\n";
+}
+
+
+/***************************************
+ * read-mostly list shared by reader threads and one writer
+****************************************/
+const int sharedListSize = 1000;
+const int readerTraversals = 2000;
+
+template<typename ReadOnce, typename WriteOnce>
+std::chrono::duration<double> sharedReadTest(int readerCount, ReadOnce readOnce, WriteOnce writeOnce)
+{
+	std::atomic<int> running(readerCount);
+	std::atomic<long long> checksum(0);
+	auto start = std::chrono::steady_clock::now();
+	Vector<std::thread *> readers;
+	for(int r = 0; r < readerCount; r++)
+	{
+		readers.append(new std::thread([&]() {
+			checksum += readOnce(readerTraversals);
+			running--;
+		}));
+	}
+	while(running.load() > 0)
+	{
+		writeOnce();
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+	for(auto it = readers.begin(); it != readers.end(); ++it)
+	{
+		(*it)->join();
+		delete *it;
+	}
+	auto end = std::chrono::steady_clock::now();
+	if(checksum.load() == 0) std::cout<<"empty traversals\n";
+	return end - start;
+}
+
+void sharedListTest(int readerCount)
+{
+	ConcurrentLinkedList<long> concurrent;
+	LinkedList<long> locked;
+	std::shared_mutex lock;
+	for(long j = 0; j < sharedListSize; j++)
+	{
+		concurrent.append(j);
+		locked.append(j);
+	}
+	long nextConcurrent = sharedListSize;
+	long nextLocked = sharedListSize;
+
+	auto concurrentTime = sharedReadTest(readerCount, [&](int traversals) {
+		ConcurrentLinkedList<long>::Reader reader(concurrent);
+		long long sum = 0;
+		for(int t = 0; t < traversals; t++)
+		{
+			for(auto it = concurrent.begin(); it != concurrent.end(); ++it) sum += *it;
+			reader.quiescent();
+		}
+		return sum;
+	}, [&]() {
+		concurrent.append(nextConcurrent++);
+		concurrent.erase(concurrent.begin());
+	});
+
+	auto lockedTime = sharedReadTest(readerCount, [&](int traversals) {
+		long long sum = 0;
+		for(int t = 0; t < traversals; t++)
+		{
+			std::shared_lock<std::shared_mutex> guard(lock);
+			for(auto it = locked.begin(); it != locked.end(); ++it) sum += *it;
+		}
+		return sum;
+	}, [&]() {
+		std::unique_lock<std::shared_mutex> guard(lock);
+		locked.append(nextLocked++);
+		locked.erase(locked.begin());
+	});
+
+	std::cout<<"ConcurrentLinkedList "<<readerCount<<" readers x "<<readerTraversals<<" traversals time: "<< std::chrono::duration_cast<std::chrono::microseconds>(concurrentTime).count()<<"\n";
+	std::cout<<"rwlock LinkedList "<<readerCount<<" readers x "<<readerTraversals<<" traversals time: "<< std::chrono::duration_cast<std::chrono::microseconds>(lockedTime).count()<<"\n";
+}
 
 int main()
 {
@@ -38,6 +163,14 @@ int main()
 	int prepend =5000;
 	int popLast = 50000;
 	int popFirst = 5000;
+	int eraseHalf = 1000000;
+	int eraseRepeat = 10;
+	int flatSize = 20000;
+	int flatRepeat = 10;
+	std::size_t largeBytes = std::size_t(1) << 30;
+	std::size_t largeReads = std::size_t(1) << 24;
+	int editText = 50000;
+	int editCount = 20000;
 	std::chrono::duration<double> vectorTime;
 	std::chrono::duration<double> linkedListTime;
 	/***************************************
@@ -168,5 +301,179 @@ int main()
 	std::cout<<"LinkedList popFirst "<<popFirst<<" elements time: "<< std::chrono::duration_cast<std::chrono::microseconds>(linkedListTime).count()/testNumber<<"\n";
 	vectorTime = std::chrono::duration<double>::zero();
 	linkedListTime = std::chrono::duration<double>::zero();
+	/***************************************
+	 * erase every second element comparision test
+	****************************************/
+	std::chrono::duration<double> listLoopTime = std::chrono::duration<double>::zero();
+	for(int i = 0;i < eraseRepeat; i++)
+	{
+		Vector<int> vector;
+		LinkedList<int> list;
+		LinkedList<int> loopList;
+		for(int j = 0; j < eraseHalf; j++)
+		{
+			vector.append(j);
+			list.append(j);
+			loopList.append(j);
+		}
+		auto startVector = std::chrono::steady_clock::now();
+		vector.eraseIf([](int x) { return x % 2 == 0; });
+		auto endVector = std::chrono::steady_clock::now();
+		vectorTime += endVector-startVector;
+		auto startList = std::chrono::steady_clock::now();
+		list.eraseIf([](int x) { return x % 2 == 0; });
+		auto endList = std::chrono::steady_clock::now();
+		linkedListTime += endList-startList;
+		auto startLoop = std::chrono::steady_clock::now();
+		for(auto it = loopList.begin(); it != loopList.end();)
+		{
+			auto next = it + 1;
+			if(*it % 2 == 0) loopList.erase(it);
+			it = next;
+		}
+		auto endLoop = std::chrono::steady_clock::now();
+		listLoopTime += endLoop-startLoop;
+	}
+	std::cout<<"Vector eraseIf half of "<<eraseHalf<<" elements time: "<< std::chrono::duration_cast<std::chrono::microseconds>(vectorTime).count()/eraseRepeat<<"\n";
+	std::cout<<"LinkedList eraseIf half of "<<eraseHalf<<" elements time: "<< std::chrono::duration_cast<std::chrono::microseconds>(linkedListTime).count()/eraseRepeat<<"\n";
+	std::cout<<"LinkedList erase loop half of "<<eraseHalf<<" elements time: "<< std::chrono::duration_cast<std::chrono::microseconds>(listLoopTime).count()/eraseRepeat<<"\n";
+	vectorTime = std::chrono::duration<double>::zero();
+	linkedListTime = std::chrono::duration<double>::zero();
+	/***************************************
+	 * sorted table build and lookup comparision test
+	****************************************/
+	std::chrono::duration<double> flatBuildTime = std::chrono::duration<double>::zero();
+	std::chrono::duration<double> flatFindTime = std::chrono::duration<double>::zero();
+	std::mt19937 generator(2017);
+	std::size_t found = 0;
+	for(int i = 0;i < flatRepeat; i++)
+	{
+		Vector<int> keys;
+		for(int j = 0; j < flatSize; j++)
+		{
+			keys.append(static_cast<int>(generator()));
+		}
+		auto startVector = std::chrono::steady_clock::now();
+		Vector<int> sorted;
+		for(auto it = keys.begin(); it != keys.end(); ++it)
+		{
+			std::size_t index = std::lower_bound(sorted.data(), sorted.data() + sorted.getSize(), *it) - sorted.data();
+			sorted.insert(sorted.cbegin() + index, *it);
+		}
+		auto endVector = std::chrono::steady_clock::now();
+		vectorTime += endVector-startVector;
+		auto startFlat = std::chrono::steady_clock::now();
+		FlatSet<int> flat;
+		flat.insertRange(keys.begin(), keys.end());
+		auto endFlat = std::chrono::steady_clock::now();
+		flatBuildTime += endFlat-startFlat;
+
+		auto startScan = std::chrono::steady_clock::now();
+		for(auto key = keys.begin(); key != keys.end(); ++key)
+		{
+			for(const int *pos = keys.data(); pos != keys.data() + keys.getSize(); ++pos)
+			{
+				if(*pos == *key)
+				{
+					found++;
+					break;
+				}
+			}
+		}
+		auto endScan = std::chrono::steady_clock::now();
+		linkedListTime += endScan-startScan;
+		auto startFind = std::chrono::steady_clock::now();
+		for(auto key = keys.begin(); key != keys.end(); ++key)
+		{
+			if(flat.find(*key) != flat.end()) found++;
+		}
+		auto endFind = std::chrono::steady_clock::now();
+		flatFindTime += endFind-startFind;
+	}
+	std::cout<<"Vector sorted insert "<<flatSize<<" elements time: "<< std::chrono::duration_cast<std::chrono::microseconds>(vectorTime).count()/flatRepeat<<"\n";
+	std::cout<<"FlatSet insertRange "<<flatSize<<" elements time: "<< std::chrono::duration_cast<std::chrono::microseconds>(flatBuildTime).count()/flatRepeat<<"\n";
+	std::cout<<"Vector linear scan "<<flatSize<<" lookups time: "<< std::chrono::duration_cast<std::chrono::microseconds>(linkedListTime).count()/flatRepeat<<"\n";
+	std::cout<<"FlatSet find "<<flatSize<<" lookups time: "<< std::chrono::duration_cast<std::chrono::microseconds>(flatFindTime).count()/flatRepeat<<" ("<<found<<" hits)\n";
+	vectorTime = std::chrono::duration<double>::zero();
+	linkedListTime = std::chrono::duration<double>::zero();
+	/***************************************
+	 * cursor-local edit trace comparision test
+	****************************************/
+	Vector<int> editCursor;
+	Vector<int> editInsert;
+	int traceSize = editText;
+	int traceCursor = editText / 2;
+	for(int j = 0; j < editCount; j++)
+	{
+		if(generator() % 1000 == 0) traceCursor = generator() % (traceSize + 1);
+		else traceCursor += static_cast<int>(generator() % 17) - 8;
+		if(traceCursor < 1) traceCursor = 1;
+		if(traceCursor > traceSize) traceCursor = traceSize;
+		bool insert = generator() % 3 != 0;
+		editCursor.append(traceCursor);
+		editInsert.append(insert ? 1 : 0);
+		traceSize += insert ? 1 : -1;
+		traceCursor += insert ? 1 : -1;
+	}
+	{
+		Vector<char> vector;
+		for(int j = 0; j < editText; j++) vector.append('a' + j % 26);
+		auto startVector = std::chrono::steady_clock::now();
+		for(int j = 0; j < editCount; j++)
+		{
+			int cursor = *(editCursor.begin() + j);
+			if(*(editInsert.begin() + j)) vector.insert(vector.begin() + cursor, 'x');
+			else vector.erase(vector.begin() + (cursor - 1));
+		}
+		auto endVector = std::chrono::steady_clock::now();
+		vectorTime += endVector-startVector;
+
+		LinkedList<char> list;
+		for(int j = 0; j < editText; j++) list.append('a' + j % 26);
+		auto startList = std::chrono::steady_clock::now();
+		auto position = list.begin();
+		int listCursor = 0;
+		for(int j = 0; j < editCount; j++)
+		{
+			int cursor = *(editCursor.begin() + j);
+			for(; listCursor < cursor; listCursor++) ++position;
+			for(; listCursor > cursor; listCursor--) --position;
+			if(*(editInsert.begin() + j))
+			{
+				list.insert(position, 'x');
+				listCursor++;
+			}
+			else
+			{
+				list.erase(position - 1);
+				listCursor--;
+			}
+		}
+		auto endList = std::chrono::steady_clock::now();
+		linkedListTime += endList-startList;
+
+		GapBuffer<char> gap;
+		for(int j = 0; j < editText; j++) gap.append('a' + j % 26);
+		auto startGap = std::chrono::steady_clock::now();
+		for(int j = 0; j < editCount; j++)
+		{
+			gap.setCursor(*(editCursor.begin() + j));
+			if(*(editInsert.begin() + j)) gap.insertAtCursor('x');
+			else gap.eraseBeforeCursor();
+		}
+		auto endGap = std::chrono::steady_clock::now();
+		std::cout<<"Vector "<<editCount<<" cursor edits time: "<< std::chrono::duration_cast<std::chrono::microseconds>(vectorTime).count()<<"\n";
+		std::cout<<"LinkedList "<<editCount<<" cursor edits time: "<< std::chrono::duration_cast<std::chrono::microseconds>(linkedListTime).count()<<"\n";
+		std::cout<<"GapBuffer "<<editCount<<" cursor edits time: "<< std::chrono::duration_cast<std::chrono::microseconds>(endGap-startGap).count()<<"\n";
+		std::cout<<"Sizes after edits: "<<vector.getSize()<<" "<<list.getSize()<<" "<<gap.getSize()<<"\n";
+	}
+	vectorTime = std::chrono::duration<double>::zero();
+	linkedListTime = std::chrono::duration<double>::zero();
+	for(int readerCount = 1; readerCount <= 8; readerCount *= 2)
+	{
+		sharedListTest(readerCount);
+	}
+	largeScanTest<HeapStorage>("Vector heap", largeBytes, largeReads);
+	largeScanTest<LargePageStorage<64>>("Vector huge pages", largeBytes, largeReads);
 	return 0;
 }